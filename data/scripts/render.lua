@@ -19,6 +19,11 @@ local DRAW_OVERLAY3 = 14
 local DRAW_SPECULAR3 = 15
 local DRAW_FULLBRIGHT3 = 16
 
+-- Lightbuffer resolution divisors for set_light_quality().
+local LIGHT_QUALITY_FULL = 1
+local LIGHT_QUALITY_HALF = 2
+local LIGHT_QUALITY_QUARTER = 4
+
 -- Convenience functions to call the rendering API functions with keyword
 -- arguments stored in a table.
 
@@ -1,5 +1,6 @@
 -- Data structure that saves a set of script references. Internally, it is a
--- map from script unique-IDs to references.
+-- map from scripts to references; a script is always the same value, so it
+-- can be used as a key directly.
 
 -- Call with an existing script set (or empty table, for a new set), and
 -- a list of scripts, for example from get_scripts_in_region. Returns the set
@@ -9,20 +10,18 @@
 -- We assume the given new scripts are real and not invalidated themselves.
 local function update_script_set(
     previous_set, new_list, add_function, remove_function)
-  new_set = {}
+  local new_set = {}
   for _, script in ipairs(new_list) do
-    uid = script:get_uid()
-    if previous_set[uid] ~= nil then
-      new_set[uid] = previous_set[uid]
-    else
+    new_set[script] = previous_set[script]
+    if new_set[script] == nil then
       add_function(script)
-      new_set[uid] = ref(script)
+      new_set[script] = ref(script)
     end
   end
   -- Handle old values.
-  for uid, ref in pairs(previous_set) do
-    if new_set[uid] == nil and ref:valid() then
-      remove_function(ref:get())
+  for script, r in pairs(previous_set) do
+    if new_set[script] == nil and r:valid() then
+      remove_function(script)
     end
   end
   return new_set
@@ -0,0 +1,26 @@
+uniform vec2 dither_off;
+uniform float dither_rot;
+
+// "Correct" dithering makes more sense mathematically (i.e. dithering in world
+// coordinates), but due to pixelated rotation accuracies produces unfortunate
+// Moire patterns any time the camera is not axis-aligned.
+// When turned off, we use a hack to keep dithering axis-aligned in camera space
+// (i.e. rotation-independent) that is nicer in general; the downside is the
+// dithering shifts independently of the world as the camera rotates.
+const bool correct_dithering = false;
+
+// Dither matrix coordinate for a texture coordinate in the native-resolution
+// image.
+vec2 get_dither_coord(vec2 tex_coord, ivec2 native_res)
+{
+  vec2 off = dither_off - mod(dither_off, 1.0);
+  if (correct_dithering) {
+    mat2 rot = mat2(cos(dither_rot), -sin(dither_rot),
+                    sin(dither_rot), cos(dither_rot));
+    return off +
+        rot * (vec2(tex_coord.x - 0.5, 0.5 - tex_coord.y) * vec2(native_res));
+  }
+  mat2 rot = mat2(cos(dither_rot), sin(dither_rot),
+                  -sin(dither_rot), cos(dither_rot));
+  return rot * off + vec2(tex_coord.x, -tex_coord.y) * vec2(native_res);
+}
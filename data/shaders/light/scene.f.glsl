@@ -1,5 +1,8 @@
 uniform sampler2D colourbuffer;
 uniform sampler2D lightbuffer;
+uniform sampler2D normalbuffer;
+uniform vec2 lightbuffer_size;
+uniform bool lightbuffer_upsample;
 noperspective varying vec2 tex_coord;
 
 #include "../gamma.glsl"
@@ -8,7 +11,10 @@ noperspective varying vec2 tex_coord;
 void main()
 {
   vec4 colour = texture2D(colourbuffer, tex_coord);
-  vec3 light = cel_shade(vec3(texture2D(lightbuffer, tex_coord)), true, false);
+  vec4 light_tex = sample_lightbuffer(
+      lightbuffer, normalbuffer,
+      lightbuffer_size, lightbuffer_upsample, tex_coord);
+  vec3 light = cel_shade(vec3(light_tex), true, false);
   // TODO: to do gamma-correct lighting, we need to convert the operands here
   // before the multiplication, and back afterwards. But I'm not exactly sure
   // which way round they need to go.
@@ -1,5 +1,8 @@
 uniform sampler2D colourbuffer;
 uniform sampler2D lightbuffer;
+uniform sampler2D normalbuffer;
+uniform vec2 lightbuffer_size;
+uniform bool lightbuffer_upsample;
 noperspective varying vec2 tex_coord;
 
 #include "util.glsl"
@@ -7,8 +10,10 @@ noperspective varying vec2 tex_coord;
 void main()
 {
   vec4 colour = texture2D(colourbuffer, tex_coord);
-  float light = cel_shade(vec3(texture2D(lightbuffer, tex_coord)).r,
-                          true, true);
+  vec4 light_tex = sample_lightbuffer(
+      lightbuffer, normalbuffer,
+      lightbuffer_size, lightbuffer_upsample, tex_coord);
+  float light = cel_shade(light_tex.r, true, true);
   colour.a *= light;
   gl_FragColor = colour;
 }
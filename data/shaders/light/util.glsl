@@ -13,6 +13,10 @@ const float camera_distance = 0.1;
 // value.
 const float layering_fade_distance = 0.05;
 
+// How strongly differences in normal and layering value suppress blending when
+// upsampling a reduced-resolution lightbuffer.
+const float upsample_edge_sharpness = 32.0;
+
 // Given coords in [-1, 1] X [-1, 1], returns vector v such that v.x and v.y
 // are the coords scaled to the unit circle, v.z is positive, and v has
 // length 1.
@@ -97,6 +101,38 @@ float layering_value_coefficient(float target_layer, float light_layer)
   return min(1.0, 1.0 - d);
 }
 
+// Samples the lightbuffer at the given coordinates. When the lightbuffer is at
+// a lower resolution than the scene, the four nearest light texels are blended
+// bilinearly, but weighted by how closely the normal and layering value they
+// were lit with match those of this pixel, so that light doesn't bleed across
+// the edges between surfaces.
+vec4 sample_lightbuffer(sampler2D lightbuffer, sampler2D normalbuffer,
+                        vec2 lightbuffer_size, bool upsample, vec2 coord)
+{
+  if (!upsample) {
+    return texture2D(lightbuffer, coord);
+  }
+  vec4 normal_tex = texture2D(normalbuffer, coord);
+  vec2 texel = coord * lightbuffer_size - 0.5;
+  vec2 base = floor(texel);
+  vec2 f = texel - base;
+
+  vec4 total = vec4(0.0);
+  float total_weight = 0.0;
+  for (int i = 0; i < 4; ++i) {
+    vec2 offset = vec2(mod(float(i), 2.0), floor(float(i) / 2.0));
+    vec2 sample_coord = (base + offset + 0.5) / lightbuffer_size;
+    vec2 bilinear = mix(1.0 - f, f, offset);
+
+    vec3 d = abs(texture2D(normalbuffer, sample_coord).rgb - normal_tex.rgb);
+    float weight = bilinear.x * bilinear.y *
+        exp(-upsample_edge_sharpness * (d.r + d.g + d.b)) + 1.0 / 1024;
+    total += weight * texture2D(lightbuffer, sample_coord);
+    total_weight += weight;
+  }
+  return total / total_weight;
+}
+
 // Implements a kind of cel-shading based on the constants above.
 float cel_shade(float light, bool ambient, bool specular)
 {
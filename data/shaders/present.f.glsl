@@ -0,0 +1,26 @@
+uniform sampler2D framebuffer;
+uniform ivec2 native_res;
+uniform ivec2 native_overflow_res;
+uniform float rotation;
+noperspective varying vec2 tex_coord;
+
+#include "dither.glsl"
+#include "dither_coord.glsl"
+
+void main()
+{
+  // Snap to the centre of the native pixel, so that every screen pixel it
+  // covers gets exactly the colour the separate crop and post passes would
+  // have given it.
+  vec2 native_coord =
+      (floor(tex_coord * vec2(native_res)) + 0.5) / vec2(native_res);
+
+  mat2 rot = mat2(cos(rotation), sin(rotation),
+                  -sin(rotation), cos(rotation));
+  vec2 crop_position = (2.0 * native_coord - 1.0) *
+      vec2(native_res) / vec2(native_overflow_res);
+  vec3 raw = vec3(texture2D(framebuffer, 0.5 + 0.5 * rot * crop_position));
+
+  vec2 coord = get_dither_coord(native_coord, native_res);
+  gl_FragColor = vec4(dither(raw, coord), 1.0);
+}
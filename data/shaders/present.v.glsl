@@ -0,0 +1,17 @@
+attribute vec2 position;
+uniform ivec2 native_res;
+uniform ivec2 screen_res;
+uniform bool integral_scale_lock;
+noperspective varying vec2 tex_coord;
+
+#include "upscale_viewport.glsl"
+
+// Crops, dithers and upscales in a single pass. The quad covers the upscaled
+// image on screen; the fragment shader works out which native pixel each
+// screen pixel belongs to.
+void main()
+{
+  tex_coord = 0.5 + 0.5 * position;
+  vec2 viewport = upscale_viewport(native_res, screen_res, integral_scale_lock);
+  gl_Position = vec4(position * viewport, 0.0, 1.0);
+}
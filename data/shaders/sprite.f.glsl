@@ -1,10 +1,11 @@
 uniform sampler2D sprite;
-uniform ivec2 frame_size;
-uniform ivec2 frame_count;
+uniform ivec2 sprite_size;
 uniform bool normal;
 
 noperspective varying vec2 tex_coord;
 flat varying vec2 frame_coord;
+flat varying vec2 frame_size_coord;
+flat varying vec4 sheet_coord;
 flat varying vec4 colour_coord;
 flat varying float depth_coord;
 
@@ -12,15 +13,17 @@ flat varying float depth_coord;
 
 void main()
 {
-  vec2 coord = mod(frame_coord, frame_count) +
-      mod(tex_coord, vec2(frame_size)) / frame_size;
+  vec2 frame_count = floor(sheet_coord.zw / frame_size_coord);
+  vec2 frame = mod(frame_coord, frame_count);
 
-  // Snap to texture pixels. This is necessary to avoid occasionally taking
-  // pixels from the next frame over at the very edge when rotating.
-  coord = coord - mod(coord, 1.0 / vec2(frame_size));
+  // Snap to texture pixels and sample from the centre. This is necessary to
+  // avoid occasionally taking pixels from the next frame over (or the next
+  // sprite over in the atlas) at the very edge when rotating.
+  vec2 texel = sheet_coord.xy + frame * frame_size_coord +
+      floor(mod(tex_coord, frame_size_coord)) + 0.5;
 
   // Base colour.
-  vec4 colour = texture2D(sprite, coord / frame_count);
+  vec4 colour = texture2D(sprite, texel / sprite_size);
   if (normal) {
     // For sprites, use the depth value as the layering value.
     colour.b += depth_coord;
@@ -1,29 +1,37 @@
 #include "pixels.glsl"
 
-attribute vec2 pixels;
+attribute vec2 corner;
 attribute vec2 origin;
 attribute vec2 frame_index;
 attribute vec4 colour;
 attribute float rotation;
 attribute float depth;
-uniform ivec2 frame_size;
+attribute vec2 frame_size;
+// Position and size of the sprite sheet within the texture.
+attribute vec4 sheet;
 
 noperspective varying vec2 tex_coord;
 flat varying vec2 frame_coord;
+flat varying vec2 frame_size_coord;
+flat varying vec4 sheet_coord;
 flat varying vec4 colour_coord;
 flat varying float depth_coord;
 
 void main()
 {
+  vec2 half_size = floor(frame_size / 2.0);
+  vec2 pixels = corner * half_size;
   mat2 rot = mat2(cos(rotation), sin(rotation),
                   -sin(rotation), cos(rotation));
   vec4 pos = pos_from_pixels(
-      (rot * pixels) + frame_size / 2 + origin);
+      (rot * pixels) + half_size + origin);
 
   gl_Position = pos;
-  tex_coord = pixels + frame_size / 2;
+  tex_coord = pixels + half_size;
 
   frame_coord = frame_index;
+  frame_size_coord = frame_size;
+  sheet_coord = sheet;
   colour_coord = colour;
   depth_coord = depth;
 }
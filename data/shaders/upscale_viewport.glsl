@@ -0,0 +1,23 @@
+// Fraction of the screen covered by the upscaled image. With the integral
+// scale lock, it's scaled up by the largest whole factor that fits; otherwise
+// it fills as much of the screen as possible while keeping the aspect ratio.
+vec2 upscale_viewport(ivec2 native_res, ivec2 screen_res,
+                      bool integral_scale_lock)
+{
+  // Correction is needed for floor/division to behave properly. Probably due
+  // to awful default drivers on Linux.
+  const float correction = 1.0 / 0xffff;
+
+  vec2 scale_v = vec2(screen_res) / vec2(native_res) + correction;
+  float scale = floor(min(scale_v.x, scale_v.y));
+
+  if (scale >= 1.0 && integral_scale_lock) {
+    return scale * native_res / vec2(screen_res);
+  }
+  float native_aspect = float(native_res.x) / native_res.y;
+  float screen_aspect = float(screen_res.x) / screen_res.y;
+  if (native_aspect >= screen_aspect) {
+    return vec2(1.0, screen_aspect / native_aspect);
+  }
+  return vec2(native_aspect / screen_aspect, 1.0);
+}
@@ -0,0 +1,751 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cache.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_cache_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_cache_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_cache_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_cache_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_cache_2eproto;
+namespace proto {
+class ScriptCache;
+struct ScriptCacheDefaultTypeInternal;
+extern ScriptCacheDefaultTypeInternal _ScriptCache_default_instance_;
+class ScriptCache_Entry;
+struct ScriptCache_EntryDefaultTypeInternal;
+extern ScriptCache_EntryDefaultTypeInternal _ScriptCache_Entry_default_instance_;
+}  // namespace proto
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto::ScriptCache* Arena::CreateMaybeMessage<::proto::ScriptCache>(Arena*);
+template<> ::proto::ScriptCache_Entry* Arena::CreateMaybeMessage<::proto::ScriptCache_Entry>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto {
+
+// ===================================================================
+
+class ScriptCache_Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ScriptCache.Entry) */ {
+ public:
+  inline ScriptCache_Entry() : ScriptCache_Entry(nullptr) {}
+  ~ScriptCache_Entry() override;
+  explicit PROTOBUF_CONSTEXPR ScriptCache_Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScriptCache_Entry(const ScriptCache_Entry& from);
+  ScriptCache_Entry(ScriptCache_Entry&& from) noexcept
+    : ScriptCache_Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline ScriptCache_Entry& operator=(const ScriptCache_Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScriptCache_Entry& operator=(ScriptCache_Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScriptCache_Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScriptCache_Entry* internal_default_instance() {
+    return reinterpret_cast<const ScriptCache_Entry*>(
+               &_ScriptCache_Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ScriptCache_Entry& a, ScriptCache_Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScriptCache_Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScriptCache_Entry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScriptCache_Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScriptCache_Entry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScriptCache_Entry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScriptCache_Entry& from) {
+    ScriptCache_Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScriptCache_Entry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.ScriptCache.Entry";
+  }
+  protected:
+  explicit ScriptCache_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kBytecodeFieldNumber = 3,
+    kHashFieldNumber = 2,
+  };
+  // required string path = 1;
+  bool has_path() const;
+  private:
+  bool _internal_has_path() const;
+  public:
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // required bytes bytecode = 3;
+  bool has_bytecode() const;
+  private:
+  bool _internal_has_bytecode() const;
+  public:
+  void clear_bytecode();
+  const std::string& bytecode() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bytecode(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bytecode();
+  PROTOBUF_NODISCARD std::string* release_bytecode();
+  void set_allocated_bytecode(std::string* bytecode);
+  private:
+  const std::string& _internal_bytecode() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bytecode(const std::string& value);
+  std::string* _internal_mutable_bytecode();
+  public:
+
+  // required uint64 hash = 2;
+  bool has_hash() const;
+  private:
+  bool _internal_has_hash() const;
+  public:
+  void clear_hash();
+  uint64_t hash() const;
+  void set_hash(uint64_t value);
+  private:
+  uint64_t _internal_hash() const;
+  void _internal_set_hash(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.ScriptCache.Entry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bytecode_;
+    uint64_t hash_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScriptCache final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ScriptCache) */ {
+ public:
+  inline ScriptCache() : ScriptCache(nullptr) {}
+  ~ScriptCache() override;
+  explicit PROTOBUF_CONSTEXPR ScriptCache(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScriptCache(const ScriptCache& from);
+  ScriptCache(ScriptCache&& from) noexcept
+    : ScriptCache() {
+    *this = ::std::move(from);
+  }
+
+  inline ScriptCache& operator=(const ScriptCache& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScriptCache& operator=(ScriptCache&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScriptCache& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScriptCache* internal_default_instance() {
+    return reinterpret_cast<const ScriptCache*>(
+               &_ScriptCache_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ScriptCache& a, ScriptCache& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScriptCache* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScriptCache* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScriptCache* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScriptCache>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScriptCache& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScriptCache& from) {
+    ScriptCache::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScriptCache* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.ScriptCache";
+  }
+  protected:
+  explicit ScriptCache(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ScriptCache_Entry Entry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 2,
+    kVersionFieldNumber = 1,
+  };
+  // repeated .proto.ScriptCache.Entry entries = 2;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::proto::ScriptCache_Entry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ScriptCache_Entry >*
+      mutable_entries();
+  private:
+  const ::proto::ScriptCache_Entry& _internal_entries(int index) const;
+  ::proto::ScriptCache_Entry* _internal_add_entries();
+  public:
+  const ::proto::ScriptCache_Entry& entries(int index) const;
+  ::proto::ScriptCache_Entry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ScriptCache_Entry >&
+      entries() const;
+
+  // required string version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.ScriptCache)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ScriptCache_Entry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ScriptCache_Entry
+
+// required string path = 1;
+inline bool ScriptCache_Entry::_internal_has_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ScriptCache_Entry::has_path() const {
+  return _internal_has_path();
+}
+inline void ScriptCache_Entry::clear_path() {
+  _impl_.path_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ScriptCache_Entry::path() const {
+  // @@protoc_insertion_point(field_get:proto.ScriptCache.Entry.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScriptCache_Entry::set_path(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.ScriptCache.Entry.path)
+}
+inline std::string* ScriptCache_Entry::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:proto.ScriptCache.Entry.path)
+  return _s;
+}
+inline const std::string& ScriptCache_Entry::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void ScriptCache_Entry::_internal_set_path(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScriptCache_Entry::_internal_mutable_path() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScriptCache_Entry::release_path() {
+  // @@protoc_insertion_point(field_release:proto.ScriptCache.Entry.path)
+  if (!_internal_has_path()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.path_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ScriptCache_Entry::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.ScriptCache.Entry.path)
+}
+
+// required uint64 hash = 2;
+inline bool ScriptCache_Entry::_internal_has_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ScriptCache_Entry::has_hash() const {
+  return _internal_has_hash();
+}
+inline void ScriptCache_Entry::clear_hash() {
+  _impl_.hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ScriptCache_Entry::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline uint64_t ScriptCache_Entry::hash() const {
+  // @@protoc_insertion_point(field_get:proto.ScriptCache.Entry.hash)
+  return _internal_hash();
+}
+inline void ScriptCache_Entry::_internal_set_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.hash_ = value;
+}
+inline void ScriptCache_Entry::set_hash(uint64_t value) {
+  _internal_set_hash(value);
+  // @@protoc_insertion_point(field_set:proto.ScriptCache.Entry.hash)
+}
+
+// required bytes bytecode = 3;
+inline bool ScriptCache_Entry::_internal_has_bytecode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ScriptCache_Entry::has_bytecode() const {
+  return _internal_has_bytecode();
+}
+inline void ScriptCache_Entry::clear_bytecode() {
+  _impl_.bytecode_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ScriptCache_Entry::bytecode() const {
+  // @@protoc_insertion_point(field_get:proto.ScriptCache.Entry.bytecode)
+  return _internal_bytecode();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScriptCache_Entry::set_bytecode(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.bytecode_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.ScriptCache.Entry.bytecode)
+}
+inline std::string* ScriptCache_Entry::mutable_bytecode() {
+  std::string* _s = _internal_mutable_bytecode();
+  // @@protoc_insertion_point(field_mutable:proto.ScriptCache.Entry.bytecode)
+  return _s;
+}
+inline const std::string& ScriptCache_Entry::_internal_bytecode() const {
+  return _impl_.bytecode_.Get();
+}
+inline void ScriptCache_Entry::_internal_set_bytecode(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.bytecode_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScriptCache_Entry::_internal_mutable_bytecode() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.bytecode_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScriptCache_Entry::release_bytecode() {
+  // @@protoc_insertion_point(field_release:proto.ScriptCache.Entry.bytecode)
+  if (!_internal_has_bytecode()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.bytecode_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bytecode_.IsDefault()) {
+    _impl_.bytecode_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ScriptCache_Entry::set_allocated_bytecode(std::string* bytecode) {
+  if (bytecode != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.bytecode_.SetAllocated(bytecode, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bytecode_.IsDefault()) {
+    _impl_.bytecode_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.ScriptCache.Entry.bytecode)
+}
+
+// -------------------------------------------------------------------
+
+// ScriptCache
+
+// required string version = 1;
+inline bool ScriptCache::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ScriptCache::has_version() const {
+  return _internal_has_version();
+}
+inline void ScriptCache::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ScriptCache::version() const {
+  // @@protoc_insertion_point(field_get:proto.ScriptCache.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScriptCache::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.ScriptCache.version)
+}
+inline std::string* ScriptCache::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:proto.ScriptCache.version)
+  return _s;
+}
+inline const std::string& ScriptCache::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void ScriptCache::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScriptCache::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScriptCache::release_version() {
+  // @@protoc_insertion_point(field_release:proto.ScriptCache.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ScriptCache::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.ScriptCache.version)
+}
+
+// repeated .proto.ScriptCache.Entry entries = 2;
+inline int ScriptCache::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int ScriptCache::entries_size() const {
+  return _internal_entries_size();
+}
+inline void ScriptCache::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::proto::ScriptCache_Entry* ScriptCache::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.ScriptCache.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ScriptCache_Entry >*
+ScriptCache::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:proto.ScriptCache.entries)
+  return &_impl_.entries_;
+}
+inline const ::proto::ScriptCache_Entry& ScriptCache::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::proto::ScriptCache_Entry& ScriptCache::entries(int index) const {
+  // @@protoc_insertion_point(field_get:proto.ScriptCache.entries)
+  return _internal_entries(index);
+}
+inline ::proto::ScriptCache_Entry* ScriptCache::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::proto::ScriptCache_Entry* ScriptCache::add_entries() {
+  ::proto::ScriptCache_Entry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:proto.ScriptCache.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ScriptCache_Entry >&
+ScriptCache::entries() const {
+  // @@protoc_insertion_point(field_list:proto.ScriptCache.entries)
+  return _impl_.entries_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_cache_2eproto
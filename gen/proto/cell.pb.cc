@@ -0,0 +1,1869 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cell.proto
+
+#include "cell.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace proto {
+PROTOBUF_CONSTEXPR Script::Script(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.min_)*/nullptr
+  , /*decltype(_impl_.max_)*/nullptr} {}
+struct ScriptDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScriptDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScriptDefaultTypeInternal() {}
+  union {
+    Script _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScriptDefaultTypeInternal _Script_default_instance_;
+PROTOBUF_CONSTEXPR Tileset::Tileset(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.collision_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TilesetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TilesetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TilesetDefaultTypeInternal() {}
+  union {
+    Tileset _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TilesetDefaultTypeInternal _Tileset_default_instance_;
+PROTOBUF_CONSTEXPR CellBlueprint_Tile::CellBlueprint_Tile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tileset_)*/0
+  , /*decltype(_impl_.index_)*/0} {}
+struct CellBlueprint_TileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CellBlueprint_TileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CellBlueprint_TileDefaultTypeInternal() {}
+  union {
+    CellBlueprint_Tile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CellBlueprint_TileDefaultTypeInternal _CellBlueprint_Tile_default_instance_;
+PROTOBUF_CONSTEXPR CellBlueprint::CellBlueprint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tilesets_)*/{}
+  , /*decltype(_impl_.tiles_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CellBlueprintDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CellBlueprintDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CellBlueprintDefaultTypeInternal() {}
+  union {
+    CellBlueprint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CellBlueprintDefaultTypeInternal _CellBlueprint_default_instance_;
+PROTOBUF_CONSTEXPR CellMap_Coord::CellMap_Coord(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.cell_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.coord_)*/nullptr} {}
+struct CellMap_CoordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CellMap_CoordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CellMap_CoordDefaultTypeInternal() {}
+  union {
+    CellMap_Coord _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CellMap_CoordDefaultTypeInternal _CellMap_Coord_default_instance_;
+PROTOBUF_CONSTEXPR CellMap::CellMap(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.coords_)*/{}
+  , /*decltype(_impl_.scripts_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CellMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CellMapDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CellMapDefaultTypeInternal() {}
+  union {
+    CellMap _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CellMapDefaultTypeInternal _CellMap_default_instance_;
+}  // namespace proto
+static ::_pb::Metadata file_level_metadata_cell_2eproto[6];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_cell_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_cell_2eproto = nullptr;
+
+const uint32_t TableStruct_cell_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::proto::Script, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto::Script, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::Script, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::proto::Script, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::proto::Script, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::proto::Script, _impl_.id_),
+  2,
+  3,
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::Tileset, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::Tileset, _impl_.collision_),
+  PROTOBUF_FIELD_OFFSET(::proto::CellBlueprint_Tile, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto::CellBlueprint_Tile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::CellBlueprint_Tile, _impl_.tileset_),
+  PROTOBUF_FIELD_OFFSET(::proto::CellBlueprint_Tile, _impl_.index_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::CellBlueprint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::CellBlueprint, _impl_.tilesets_),
+  PROTOBUF_FIELD_OFFSET(::proto::CellBlueprint, _impl_.tiles_),
+  PROTOBUF_FIELD_OFFSET(::proto::CellMap_Coord, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto::CellMap_Coord, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::CellMap_Coord, _impl_.coord_),
+  PROTOBUF_FIELD_OFFSET(::proto::CellMap_Coord, _impl_.cell_),
+  1,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::CellMap, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::CellMap, _impl_.coords_),
+  PROTOBUF_FIELD_OFFSET(::proto::CellMap, _impl_.scripts_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::proto::Script)},
+  { 14, -1, -1, sizeof(::proto::Tileset)},
+  { 21, 29, -1, sizeof(::proto::CellBlueprint_Tile)},
+  { 31, -1, -1, sizeof(::proto::CellBlueprint)},
+  { 39, 47, -1, sizeof(::proto::CellMap_Coord)},
+  { 49, -1, -1, sizeof(::proto::CellMap)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::proto::_Script_default_instance_._instance,
+  &::proto::_Tileset_default_instance_._instance,
+  &::proto::_CellBlueprint_Tile_default_instance_._instance,
+  &::proto::_CellBlueprint_default_instance_._instance,
+  &::proto::_CellMap_Coord_default_instance_._instance,
+  &::proto::_CellMap_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_cell_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\ncell.proto\022\005proto\032\014common.proto\"X\n\006Scr"
+  "ipt\022\031\n\003min\030\001 \002(\0132\014.proto.ivec2\022\031\n\003max\030\002 "
+  "\002(\0132\014.proto.ivec2\022\014\n\004path\030\003 \002(\t\022\n\n\002id\030\004 "
+  "\001(\t\"\034\n\007Tileset\022\021\n\tcollision\030\001 \003(\r\"s\n\rCel"
+  "lBlueprint\022\020\n\010tilesets\030\001 \003(\t\022(\n\005tiles\030\002 "
+  "\003(\0132\031.proto.CellBlueprint.Tile\032&\n\004Tile\022\017"
+  "\n\007tileset\030\001 \002(\005\022\r\n\005index\030\002 \002(\005\"\203\001\n\007CellM"
+  "ap\022$\n\006coords\030\001 \003(\0132\024.proto.CellMap.Coord"
+  "\022\036\n\007scripts\030\002 \003(\0132\r.proto.Script\0322\n\005Coor"
+  "d\022\033\n\005coord\030\001 \002(\0132\014.proto.ivec2\022\014\n\004cell\030\002"
+  " \002(\t"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_cell_2eproto_deps[1] = {
+  &::descriptor_table_common_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_cell_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_cell_2eproto = {
+    false, false, 404, descriptor_table_protodef_cell_2eproto,
+    "cell.proto",
+    &descriptor_table_cell_2eproto_once, descriptor_table_cell_2eproto_deps, 1, 6,
+    schemas, file_default_instances, TableStruct_cell_2eproto::offsets,
+    file_level_metadata_cell_2eproto, file_level_enum_descriptors_cell_2eproto,
+    file_level_service_descriptors_cell_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_cell_2eproto_getter() {
+  return &descriptor_table_cell_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_cell_2eproto(&descriptor_table_cell_2eproto);
+namespace proto {
+
+// ===================================================================
+
+class Script::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Script>()._impl_._has_bits_);
+  static const ::proto::ivec2& min(const Script* msg);
+  static void set_has_min(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::proto::ivec2& max(const Script* msg);
+  static void set_has_max(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000d) ^ 0x0000000d) != 0;
+  }
+};
+
+const ::proto::ivec2&
+Script::_Internal::min(const Script* msg) {
+  return *msg->_impl_.min_;
+}
+const ::proto::ivec2&
+Script::_Internal::max(const Script* msg) {
+  return *msg->_impl_.max_;
+}
+void Script::clear_min() {
+  if (_impl_.min_ != nullptr) _impl_.min_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+void Script::clear_max() {
+  if (_impl_.max_ != nullptr) _impl_.max_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+Script::Script(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.Script)
+}
+Script::Script(const Script& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Script* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.min_){nullptr}
+    , decltype(_impl_.max_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_path()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_id()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_min()) {
+    _this->_impl_.min_ = new ::proto::ivec2(*from._impl_.min_);
+  }
+  if (from._internal_has_max()) {
+    _this->_impl_.max_ = new ::proto::ivec2(*from._impl_.max_);
+  }
+  // @@protoc_insertion_point(copy_constructor:proto.Script)
+}
+
+inline void Script::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.min_){nullptr}
+    , decltype(_impl_.max_){nullptr}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Script::~Script() {
+  // @@protoc_insertion_point(destructor:proto.Script)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Script::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
+  _impl_.id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.min_;
+  if (this != internal_default_instance()) delete _impl_.max_;
+}
+
+void Script::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Script::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Script)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.path_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.min_ != nullptr);
+      _impl_.min_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.max_ != nullptr);
+      _impl_.max_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Script::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .proto.ivec2 min = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_min(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .proto.ivec2 max = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_max(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string path = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "proto.Script.path");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "proto.Script.id");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Script::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Script)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .proto.ivec2 min = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::min(this),
+        _Internal::min(this).GetCachedSize(), target, stream);
+  }
+
+  // required .proto.ivec2 max = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::max(this),
+        _Internal::max(this).GetCachedSize(), target, stream);
+  }
+
+  // required string path = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "proto.Script.path");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_path(), target);
+  }
+
+  // optional string id = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "proto.Script.id");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Script)
+  return target;
+}
+
+size_t Script::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.Script)
+  size_t total_size = 0;
+
+  if (_internal_has_path()) {
+    // required string path = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
+  }
+
+  if (_internal_has_min()) {
+    // required .proto.ivec2 min = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.min_);
+  }
+
+  if (_internal_has_max()) {
+    // required .proto.ivec2 max = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.max_);
+  }
+
+  return total_size;
+}
+size_t Script::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Script)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000d) ^ 0x0000000d) == 0) {  // All required fields are present.
+    // required string path = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
+
+    // required .proto.ivec2 min = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.min_);
+
+    // required .proto.ivec2 max = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.max_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string id = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Script::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Script::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Script::GetClassData() const { return &_class_data_; }
+
+
+void Script::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Script*>(&to_msg);
+  auto& from = static_cast<const Script&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.Script)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_path(from._internal_path());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_id(from._internal_id());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_min()->::proto::ivec2::MergeFrom(
+          from._internal_min());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_max()->::proto::ivec2::MergeFrom(
+          from._internal_max());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Script::CopyFrom(const Script& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Script)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Script::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_min()) {
+    if (!_impl_.min_->IsInitialized()) return false;
+  }
+  if (_internal_has_max()) {
+    if (!_impl_.max_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Script::InternalSwap(Script* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Script, _impl_.max_)
+      + sizeof(Script::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(Script, _impl_.min_)>(
+          reinterpret_cast<char*>(&_impl_.min_),
+          reinterpret_cast<char*>(&other->_impl_.min_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Script::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cell_2eproto_getter, &descriptor_table_cell_2eproto_once,
+      file_level_metadata_cell_2eproto[0]);
+}
+
+// ===================================================================
+
+class Tileset::_Internal {
+ public:
+};
+
+Tileset::Tileset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.Tileset)
+}
+Tileset::Tileset(const Tileset& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Tileset* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.collision_){from._impl_.collision_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto.Tileset)
+}
+
+inline void Tileset::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.collision_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Tileset::~Tileset() {
+  // @@protoc_insertion_point(destructor:proto.Tileset)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Tileset::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.collision_.~RepeatedField();
+}
+
+void Tileset::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Tileset::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Tileset)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.collision_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Tileset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 collision = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_collision(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_collision(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Tileset::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Tileset)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 collision = 1;
+  for (int i = 0, n = this->_internal_collision_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_collision(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Tileset)
+  return target;
+}
+
+size_t Tileset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Tileset)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 collision = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.collision_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_collision_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Tileset::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Tileset::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Tileset::GetClassData() const { return &_class_data_; }
+
+
+void Tileset::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Tileset*>(&to_msg);
+  auto& from = static_cast<const Tileset&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.Tileset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.collision_.MergeFrom(from._impl_.collision_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Tileset::CopyFrom(const Tileset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Tileset)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Tileset::IsInitialized() const {
+  return true;
+}
+
+void Tileset::InternalSwap(Tileset* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.collision_.InternalSwap(&other->_impl_.collision_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Tileset::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cell_2eproto_getter, &descriptor_table_cell_2eproto_once,
+      file_level_metadata_cell_2eproto[1]);
+}
+
+// ===================================================================
+
+class CellBlueprint_Tile::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CellBlueprint_Tile>()._impl_._has_bits_);
+  static void set_has_tileset(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+CellBlueprint_Tile::CellBlueprint_Tile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.CellBlueprint.Tile)
+}
+CellBlueprint_Tile::CellBlueprint_Tile(const CellBlueprint_Tile& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CellBlueprint_Tile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tileset_){}
+    , decltype(_impl_.index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.tileset_, &from._impl_.tileset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.index_) -
+    reinterpret_cast<char*>(&_impl_.tileset_)) + sizeof(_impl_.index_));
+  // @@protoc_insertion_point(copy_constructor:proto.CellBlueprint.Tile)
+}
+
+inline void CellBlueprint_Tile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tileset_){0}
+    , decltype(_impl_.index_){0}
+  };
+}
+
+CellBlueprint_Tile::~CellBlueprint_Tile() {
+  // @@protoc_insertion_point(destructor:proto.CellBlueprint.Tile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CellBlueprint_Tile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CellBlueprint_Tile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CellBlueprint_Tile::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.CellBlueprint.Tile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.tileset_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.index_) -
+        reinterpret_cast<char*>(&_impl_.tileset_)) + sizeof(_impl_.index_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CellBlueprint_Tile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 tileset = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tileset(&has_bits);
+          _impl_.tileset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_index(&has_bits);
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CellBlueprint_Tile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.CellBlueprint.Tile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 tileset = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_tileset(), target);
+  }
+
+  // required int32 index = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.CellBlueprint.Tile)
+  return target;
+}
+
+size_t CellBlueprint_Tile::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.CellBlueprint.Tile)
+  size_t total_size = 0;
+
+  if (_internal_has_tileset()) {
+    // required int32 tileset = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tileset());
+  }
+
+  if (_internal_has_index()) {
+    // required int32 index = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+  }
+
+  return total_size;
+}
+size_t CellBlueprint_Tile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.CellBlueprint.Tile)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required int32 tileset = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tileset());
+
+    // required int32 index = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CellBlueprint_Tile::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CellBlueprint_Tile::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CellBlueprint_Tile::GetClassData() const { return &_class_data_; }
+
+
+void CellBlueprint_Tile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CellBlueprint_Tile*>(&to_msg);
+  auto& from = static_cast<const CellBlueprint_Tile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.CellBlueprint.Tile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.tileset_ = from._impl_.tileset_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.index_ = from._impl_.index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CellBlueprint_Tile::CopyFrom(const CellBlueprint_Tile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.CellBlueprint.Tile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CellBlueprint_Tile::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CellBlueprint_Tile::InternalSwap(CellBlueprint_Tile* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CellBlueprint_Tile, _impl_.index_)
+      + sizeof(CellBlueprint_Tile::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(CellBlueprint_Tile, _impl_.tileset_)>(
+          reinterpret_cast<char*>(&_impl_.tileset_),
+          reinterpret_cast<char*>(&other->_impl_.tileset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CellBlueprint_Tile::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cell_2eproto_getter, &descriptor_table_cell_2eproto_once,
+      file_level_metadata_cell_2eproto[2]);
+}
+
+// ===================================================================
+
+class CellBlueprint::_Internal {
+ public:
+};
+
+CellBlueprint::CellBlueprint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.CellBlueprint)
+}
+CellBlueprint::CellBlueprint(const CellBlueprint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CellBlueprint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tilesets_){from._impl_.tilesets_}
+    , decltype(_impl_.tiles_){from._impl_.tiles_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto.CellBlueprint)
+}
+
+inline void CellBlueprint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tilesets_){arena}
+    , decltype(_impl_.tiles_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CellBlueprint::~CellBlueprint() {
+  // @@protoc_insertion_point(destructor:proto.CellBlueprint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CellBlueprint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tilesets_.~RepeatedPtrField();
+  _impl_.tiles_.~RepeatedPtrField();
+}
+
+void CellBlueprint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CellBlueprint::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.CellBlueprint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tilesets_.Clear();
+  _impl_.tiles_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CellBlueprint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string tilesets = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_tilesets();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "proto.CellBlueprint.tilesets");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto.CellBlueprint.Tile tiles = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tiles(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CellBlueprint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.CellBlueprint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string tilesets = 1;
+  for (int i = 0, n = this->_internal_tilesets_size(); i < n; i++) {
+    const auto& s = this->_internal_tilesets(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "proto.CellBlueprint.tilesets");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated .proto.CellBlueprint.Tile tiles = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tiles_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tiles(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.CellBlueprint)
+  return target;
+}
+
+size_t CellBlueprint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.CellBlueprint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string tilesets = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.tilesets_.size());
+  for (int i = 0, n = _impl_.tilesets_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.tilesets_.Get(i));
+  }
+
+  // repeated .proto.CellBlueprint.Tile tiles = 2;
+  total_size += 1UL * this->_internal_tiles_size();
+  for (const auto& msg : this->_impl_.tiles_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CellBlueprint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CellBlueprint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CellBlueprint::GetClassData() const { return &_class_data_; }
+
+
+void CellBlueprint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CellBlueprint*>(&to_msg);
+  auto& from = static_cast<const CellBlueprint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.CellBlueprint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tilesets_.MergeFrom(from._impl_.tilesets_);
+  _this->_impl_.tiles_.MergeFrom(from._impl_.tiles_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CellBlueprint::CopyFrom(const CellBlueprint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.CellBlueprint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CellBlueprint::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.tiles_))
+    return false;
+  return true;
+}
+
+void CellBlueprint::InternalSwap(CellBlueprint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.tilesets_.InternalSwap(&other->_impl_.tilesets_);
+  _impl_.tiles_.InternalSwap(&other->_impl_.tiles_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CellBlueprint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cell_2eproto_getter, &descriptor_table_cell_2eproto_once,
+      file_level_metadata_cell_2eproto[3]);
+}
+
+// ===================================================================
+
+class CellMap_Coord::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CellMap_Coord>()._impl_._has_bits_);
+  static const ::proto::ivec2& coord(const CellMap_Coord* msg);
+  static void set_has_coord(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_cell(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::proto::ivec2&
+CellMap_Coord::_Internal::coord(const CellMap_Coord* msg) {
+  return *msg->_impl_.coord_;
+}
+void CellMap_Coord::clear_coord() {
+  if (_impl_.coord_ != nullptr) _impl_.coord_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+CellMap_Coord::CellMap_Coord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.CellMap.Coord)
+}
+CellMap_Coord::CellMap_Coord(const CellMap_Coord& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CellMap_Coord* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cell_){}
+    , decltype(_impl_.coord_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cell_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cell_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cell()) {
+    _this->_impl_.cell_.Set(from._internal_cell(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_coord()) {
+    _this->_impl_.coord_ = new ::proto::ivec2(*from._impl_.coord_);
+  }
+  // @@protoc_insertion_point(copy_constructor:proto.CellMap.Coord)
+}
+
+inline void CellMap_Coord::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cell_){}
+    , decltype(_impl_.coord_){nullptr}
+  };
+  _impl_.cell_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cell_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CellMap_Coord::~CellMap_Coord() {
+  // @@protoc_insertion_point(destructor:proto.CellMap.Coord)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CellMap_Coord::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cell_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.coord_;
+}
+
+void CellMap_Coord::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CellMap_Coord::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.CellMap.Coord)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.cell_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.coord_ != nullptr);
+      _impl_.coord_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CellMap_Coord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .proto.ivec2 coord = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_coord(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string cell = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cell();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "proto.CellMap.Coord.cell");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CellMap_Coord::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.CellMap.Coord)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .proto.ivec2 coord = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::coord(this),
+        _Internal::coord(this).GetCachedSize(), target, stream);
+  }
+
+  // required string cell = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_cell().data(), static_cast<int>(this->_internal_cell().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "proto.CellMap.Coord.cell");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cell(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.CellMap.Coord)
+  return target;
+}
+
+size_t CellMap_Coord::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.CellMap.Coord)
+  size_t total_size = 0;
+
+  if (_internal_has_cell()) {
+    // required string cell = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cell());
+  }
+
+  if (_internal_has_coord()) {
+    // required .proto.ivec2 coord = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.coord_);
+  }
+
+  return total_size;
+}
+size_t CellMap_Coord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.CellMap.Coord)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string cell = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cell());
+
+    // required .proto.ivec2 coord = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.coord_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CellMap_Coord::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CellMap_Coord::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CellMap_Coord::GetClassData() const { return &_class_data_; }
+
+
+void CellMap_Coord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CellMap_Coord*>(&to_msg);
+  auto& from = static_cast<const CellMap_Coord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.CellMap.Coord)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_cell(from._internal_cell());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_coord()->::proto::ivec2::MergeFrom(
+          from._internal_coord());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CellMap_Coord::CopyFrom(const CellMap_Coord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.CellMap.Coord)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CellMap_Coord::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_coord()) {
+    if (!_impl_.coord_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CellMap_Coord::InternalSwap(CellMap_Coord* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cell_, lhs_arena,
+      &other->_impl_.cell_, rhs_arena
+  );
+  swap(_impl_.coord_, other->_impl_.coord_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CellMap_Coord::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cell_2eproto_getter, &descriptor_table_cell_2eproto_once,
+      file_level_metadata_cell_2eproto[4]);
+}
+
+// ===================================================================
+
+class CellMap::_Internal {
+ public:
+};
+
+CellMap::CellMap(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.CellMap)
+}
+CellMap::CellMap(const CellMap& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CellMap* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.coords_){from._impl_.coords_}
+    , decltype(_impl_.scripts_){from._impl_.scripts_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto.CellMap)
+}
+
+inline void CellMap::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.coords_){arena}
+    , decltype(_impl_.scripts_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CellMap::~CellMap() {
+  // @@protoc_insertion_point(destructor:proto.CellMap)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CellMap::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.coords_.~RepeatedPtrField();
+  _impl_.scripts_.~RepeatedPtrField();
+}
+
+void CellMap::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CellMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.CellMap)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.coords_.Clear();
+  _impl_.scripts_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CellMap::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proto.CellMap.Coord coords = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_coords(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto.Script scripts = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_scripts(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CellMap::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.CellMap)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .proto.CellMap.Coord coords = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_coords_size()); i < n; i++) {
+    const auto& repfield = this->_internal_coords(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .proto.Script scripts = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_scripts_size()); i < n; i++) {
+    const auto& repfield = this->_internal_scripts(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.CellMap)
+  return target;
+}
+
+size_t CellMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.CellMap)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto.CellMap.Coord coords = 1;
+  total_size += 1UL * this->_internal_coords_size();
+  for (const auto& msg : this->_impl_.coords_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .proto.Script scripts = 2;
+  total_size += 1UL * this->_internal_scripts_size();
+  for (const auto& msg : this->_impl_.scripts_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CellMap::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CellMap::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CellMap::GetClassData() const { return &_class_data_; }
+
+
+void CellMap::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CellMap*>(&to_msg);
+  auto& from = static_cast<const CellMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.CellMap)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.coords_.MergeFrom(from._impl_.coords_);
+  _this->_impl_.scripts_.MergeFrom(from._impl_.scripts_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CellMap::CopyFrom(const CellMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.CellMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CellMap::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.coords_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.scripts_))
+    return false;
+  return true;
+}
+
+void CellMap::InternalSwap(CellMap* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.coords_.InternalSwap(&other->_impl_.coords_);
+  _impl_.scripts_.InternalSwap(&other->_impl_.scripts_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CellMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cell_2eproto_getter, &descriptor_table_cell_2eproto_once,
+      file_level_metadata_cell_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto::Script*
+Arena::CreateMaybeMessage< ::proto::Script >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Script >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::Tileset*
+Arena::CreateMaybeMessage< ::proto::Tileset >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Tileset >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::CellBlueprint_Tile*
+Arena::CreateMaybeMessage< ::proto::CellBlueprint_Tile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::CellBlueprint_Tile >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::CellBlueprint*
+Arena::CreateMaybeMessage< ::proto::CellBlueprint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::CellBlueprint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::CellMap_Coord*
+Arena::CreateMaybeMessage< ::proto::CellMap_Coord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::CellMap_Coord >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::CellMap*
+Arena::CreateMaybeMessage< ::proto::CellMap >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::CellMap >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
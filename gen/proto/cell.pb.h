@@ -0,0 +1,2033 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cell.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_cell_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_cell_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_cell_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_cell_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_cell_2eproto;
+namespace proto {
+class CellBlueprint;
+struct CellBlueprintDefaultTypeInternal;
+extern CellBlueprintDefaultTypeInternal _CellBlueprint_default_instance_;
+class CellBlueprint_Tile;
+struct CellBlueprint_TileDefaultTypeInternal;
+extern CellBlueprint_TileDefaultTypeInternal _CellBlueprint_Tile_default_instance_;
+class CellMap;
+struct CellMapDefaultTypeInternal;
+extern CellMapDefaultTypeInternal _CellMap_default_instance_;
+class CellMap_Coord;
+struct CellMap_CoordDefaultTypeInternal;
+extern CellMap_CoordDefaultTypeInternal _CellMap_Coord_default_instance_;
+class Script;
+struct ScriptDefaultTypeInternal;
+extern ScriptDefaultTypeInternal _Script_default_instance_;
+class Tileset;
+struct TilesetDefaultTypeInternal;
+extern TilesetDefaultTypeInternal _Tileset_default_instance_;
+}  // namespace proto
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto::CellBlueprint* Arena::CreateMaybeMessage<::proto::CellBlueprint>(Arena*);
+template<> ::proto::CellBlueprint_Tile* Arena::CreateMaybeMessage<::proto::CellBlueprint_Tile>(Arena*);
+template<> ::proto::CellMap* Arena::CreateMaybeMessage<::proto::CellMap>(Arena*);
+template<> ::proto::CellMap_Coord* Arena::CreateMaybeMessage<::proto::CellMap_Coord>(Arena*);
+template<> ::proto::Script* Arena::CreateMaybeMessage<::proto::Script>(Arena*);
+template<> ::proto::Tileset* Arena::CreateMaybeMessage<::proto::Tileset>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto {
+
+// ===================================================================
+
+class Script final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Script) */ {
+ public:
+  inline Script() : Script(nullptr) {}
+  ~Script() override;
+  explicit PROTOBUF_CONSTEXPR Script(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Script(const Script& from);
+  Script(Script&& from) noexcept
+    : Script() {
+    *this = ::std::move(from);
+  }
+
+  inline Script& operator=(const Script& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Script& operator=(Script&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Script& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Script* internal_default_instance() {
+    return reinterpret_cast<const Script*>(
+               &_Script_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Script& a, Script& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Script* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Script* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Script* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Script>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Script& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Script& from) {
+    Script::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Script* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Script";
+  }
+  protected:
+  explicit Script(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 3,
+    kIdFieldNumber = 4,
+    kMinFieldNumber = 1,
+    kMaxFieldNumber = 2,
+  };
+  // required string path = 3;
+  bool has_path() const;
+  private:
+  bool _internal_has_path() const;
+  public:
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // optional string id = 4;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // required .proto.ivec2 min = 1;
+  bool has_min() const;
+  private:
+  bool _internal_has_min() const;
+  public:
+  void clear_min();
+  const ::proto::ivec2& min() const;
+  PROTOBUF_NODISCARD ::proto::ivec2* release_min();
+  ::proto::ivec2* mutable_min();
+  void set_allocated_min(::proto::ivec2* min);
+  private:
+  const ::proto::ivec2& _internal_min() const;
+  ::proto::ivec2* _internal_mutable_min();
+  public:
+  void unsafe_arena_set_allocated_min(
+      ::proto::ivec2* min);
+  ::proto::ivec2* unsafe_arena_release_min();
+
+  // required .proto.ivec2 max = 2;
+  bool has_max() const;
+  private:
+  bool _internal_has_max() const;
+  public:
+  void clear_max();
+  const ::proto::ivec2& max() const;
+  PROTOBUF_NODISCARD ::proto::ivec2* release_max();
+  ::proto::ivec2* mutable_max();
+  void set_allocated_max(::proto::ivec2* max);
+  private:
+  const ::proto::ivec2& _internal_max() const;
+  ::proto::ivec2* _internal_mutable_max();
+  public:
+  void unsafe_arena_set_allocated_max(
+      ::proto::ivec2* max);
+  ::proto::ivec2* unsafe_arena_release_max();
+
+  // @@protoc_insertion_point(class_scope:proto.Script)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::proto::ivec2* min_;
+    ::proto::ivec2* max_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cell_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Tileset final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Tileset) */ {
+ public:
+  inline Tileset() : Tileset(nullptr) {}
+  ~Tileset() override;
+  explicit PROTOBUF_CONSTEXPR Tileset(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Tileset(const Tileset& from);
+  Tileset(Tileset&& from) noexcept
+    : Tileset() {
+    *this = ::std::move(from);
+  }
+
+  inline Tileset& operator=(const Tileset& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Tileset& operator=(Tileset&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Tileset& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Tileset* internal_default_instance() {
+    return reinterpret_cast<const Tileset*>(
+               &_Tileset_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Tileset& a, Tileset& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Tileset* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Tileset* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Tileset* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Tileset>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Tileset& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Tileset& from) {
+    Tileset::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Tileset* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Tileset";
+  }
+  protected:
+  explicit Tileset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCollisionFieldNumber = 1,
+  };
+  // repeated uint32 collision = 1;
+  int collision_size() const;
+  private:
+  int _internal_collision_size() const;
+  public:
+  void clear_collision();
+  private:
+  uint32_t _internal_collision(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_collision() const;
+  void _internal_add_collision(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_collision();
+  public:
+  uint32_t collision(int index) const;
+  void set_collision(int index, uint32_t value);
+  void add_collision(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      collision() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_collision();
+
+  // @@protoc_insertion_point(class_scope:proto.Tileset)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > collision_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cell_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CellBlueprint_Tile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.CellBlueprint.Tile) */ {
+ public:
+  inline CellBlueprint_Tile() : CellBlueprint_Tile(nullptr) {}
+  ~CellBlueprint_Tile() override;
+  explicit PROTOBUF_CONSTEXPR CellBlueprint_Tile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CellBlueprint_Tile(const CellBlueprint_Tile& from);
+  CellBlueprint_Tile(CellBlueprint_Tile&& from) noexcept
+    : CellBlueprint_Tile() {
+    *this = ::std::move(from);
+  }
+
+  inline CellBlueprint_Tile& operator=(const CellBlueprint_Tile& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CellBlueprint_Tile& operator=(CellBlueprint_Tile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CellBlueprint_Tile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CellBlueprint_Tile* internal_default_instance() {
+    return reinterpret_cast<const CellBlueprint_Tile*>(
+               &_CellBlueprint_Tile_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CellBlueprint_Tile& a, CellBlueprint_Tile& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CellBlueprint_Tile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CellBlueprint_Tile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CellBlueprint_Tile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CellBlueprint_Tile>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CellBlueprint_Tile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CellBlueprint_Tile& from) {
+    CellBlueprint_Tile::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CellBlueprint_Tile* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.CellBlueprint.Tile";
+  }
+  protected:
+  explicit CellBlueprint_Tile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTilesetFieldNumber = 1,
+    kIndexFieldNumber = 2,
+  };
+  // required int32 tileset = 1;
+  bool has_tileset() const;
+  private:
+  bool _internal_has_tileset() const;
+  public:
+  void clear_tileset();
+  int32_t tileset() const;
+  void set_tileset(int32_t value);
+  private:
+  int32_t _internal_tileset() const;
+  void _internal_set_tileset(int32_t value);
+  public:
+
+  // required int32 index = 2;
+  bool has_index() const;
+  private:
+  bool _internal_has_index() const;
+  public:
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
+  private:
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.CellBlueprint.Tile)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t tileset_;
+    int32_t index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cell_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CellBlueprint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.CellBlueprint) */ {
+ public:
+  inline CellBlueprint() : CellBlueprint(nullptr) {}
+  ~CellBlueprint() override;
+  explicit PROTOBUF_CONSTEXPR CellBlueprint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CellBlueprint(const CellBlueprint& from);
+  CellBlueprint(CellBlueprint&& from) noexcept
+    : CellBlueprint() {
+    *this = ::std::move(from);
+  }
+
+  inline CellBlueprint& operator=(const CellBlueprint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CellBlueprint& operator=(CellBlueprint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CellBlueprint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CellBlueprint* internal_default_instance() {
+    return reinterpret_cast<const CellBlueprint*>(
+               &_CellBlueprint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CellBlueprint& a, CellBlueprint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CellBlueprint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CellBlueprint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CellBlueprint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CellBlueprint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CellBlueprint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CellBlueprint& from) {
+    CellBlueprint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CellBlueprint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.CellBlueprint";
+  }
+  protected:
+  explicit CellBlueprint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CellBlueprint_Tile Tile;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTilesetsFieldNumber = 1,
+    kTilesFieldNumber = 2,
+  };
+  // repeated string tilesets = 1;
+  int tilesets_size() const;
+  private:
+  int _internal_tilesets_size() const;
+  public:
+  void clear_tilesets();
+  const std::string& tilesets(int index) const;
+  std::string* mutable_tilesets(int index);
+  void set_tilesets(int index, const std::string& value);
+  void set_tilesets(int index, std::string&& value);
+  void set_tilesets(int index, const char* value);
+  void set_tilesets(int index, const char* value, size_t size);
+  std::string* add_tilesets();
+  void add_tilesets(const std::string& value);
+  void add_tilesets(std::string&& value);
+  void add_tilesets(const char* value);
+  void add_tilesets(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& tilesets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_tilesets();
+  private:
+  const std::string& _internal_tilesets(int index) const;
+  std::string* _internal_add_tilesets();
+  public:
+
+  // repeated .proto.CellBlueprint.Tile tiles = 2;
+  int tiles_size() const;
+  private:
+  int _internal_tiles_size() const;
+  public:
+  void clear_tiles();
+  ::proto::CellBlueprint_Tile* mutable_tiles(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellBlueprint_Tile >*
+      mutable_tiles();
+  private:
+  const ::proto::CellBlueprint_Tile& _internal_tiles(int index) const;
+  ::proto::CellBlueprint_Tile* _internal_add_tiles();
+  public:
+  const ::proto::CellBlueprint_Tile& tiles(int index) const;
+  ::proto::CellBlueprint_Tile* add_tiles();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellBlueprint_Tile >&
+      tiles() const;
+
+  // @@protoc_insertion_point(class_scope:proto.CellBlueprint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> tilesets_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellBlueprint_Tile > tiles_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cell_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CellMap_Coord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.CellMap.Coord) */ {
+ public:
+  inline CellMap_Coord() : CellMap_Coord(nullptr) {}
+  ~CellMap_Coord() override;
+  explicit PROTOBUF_CONSTEXPR CellMap_Coord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CellMap_Coord(const CellMap_Coord& from);
+  CellMap_Coord(CellMap_Coord&& from) noexcept
+    : CellMap_Coord() {
+    *this = ::std::move(from);
+  }
+
+  inline CellMap_Coord& operator=(const CellMap_Coord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CellMap_Coord& operator=(CellMap_Coord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CellMap_Coord& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CellMap_Coord* internal_default_instance() {
+    return reinterpret_cast<const CellMap_Coord*>(
+               &_CellMap_Coord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CellMap_Coord& a, CellMap_Coord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CellMap_Coord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CellMap_Coord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CellMap_Coord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CellMap_Coord>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CellMap_Coord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CellMap_Coord& from) {
+    CellMap_Coord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CellMap_Coord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.CellMap.Coord";
+  }
+  protected:
+  explicit CellMap_Coord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCellFieldNumber = 2,
+    kCoordFieldNumber = 1,
+  };
+  // required string cell = 2;
+  bool has_cell() const;
+  private:
+  bool _internal_has_cell() const;
+  public:
+  void clear_cell();
+  const std::string& cell() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cell(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cell();
+  PROTOBUF_NODISCARD std::string* release_cell();
+  void set_allocated_cell(std::string* cell);
+  private:
+  const std::string& _internal_cell() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cell(const std::string& value);
+  std::string* _internal_mutable_cell();
+  public:
+
+  // required .proto.ivec2 coord = 1;
+  bool has_coord() const;
+  private:
+  bool _internal_has_coord() const;
+  public:
+  void clear_coord();
+  const ::proto::ivec2& coord() const;
+  PROTOBUF_NODISCARD ::proto::ivec2* release_coord();
+  ::proto::ivec2* mutable_coord();
+  void set_allocated_coord(::proto::ivec2* coord);
+  private:
+  const ::proto::ivec2& _internal_coord() const;
+  ::proto::ivec2* _internal_mutable_coord();
+  public:
+  void unsafe_arena_set_allocated_coord(
+      ::proto::ivec2* coord);
+  ::proto::ivec2* unsafe_arena_release_coord();
+
+  // @@protoc_insertion_point(class_scope:proto.CellMap.Coord)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cell_;
+    ::proto::ivec2* coord_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cell_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CellMap final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.CellMap) */ {
+ public:
+  inline CellMap() : CellMap(nullptr) {}
+  ~CellMap() override;
+  explicit PROTOBUF_CONSTEXPR CellMap(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CellMap(const CellMap& from);
+  CellMap(CellMap&& from) noexcept
+    : CellMap() {
+    *this = ::std::move(from);
+  }
+
+  inline CellMap& operator=(const CellMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CellMap& operator=(CellMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CellMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CellMap* internal_default_instance() {
+    return reinterpret_cast<const CellMap*>(
+               &_CellMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CellMap& a, CellMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CellMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CellMap* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CellMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CellMap>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CellMap& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CellMap& from) {
+    CellMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CellMap* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.CellMap";
+  }
+  protected:
+  explicit CellMap(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CellMap_Coord Coord;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCoordsFieldNumber = 1,
+    kScriptsFieldNumber = 2,
+  };
+  // repeated .proto.CellMap.Coord coords = 1;
+  int coords_size() const;
+  private:
+  int _internal_coords_size() const;
+  public:
+  void clear_coords();
+  ::proto::CellMap_Coord* mutable_coords(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellMap_Coord >*
+      mutable_coords();
+  private:
+  const ::proto::CellMap_Coord& _internal_coords(int index) const;
+  ::proto::CellMap_Coord* _internal_add_coords();
+  public:
+  const ::proto::CellMap_Coord& coords(int index) const;
+  ::proto::CellMap_Coord* add_coords();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellMap_Coord >&
+      coords() const;
+
+  // repeated .proto.Script scripts = 2;
+  int scripts_size() const;
+  private:
+  int _internal_scripts_size() const;
+  public:
+  void clear_scripts();
+  ::proto::Script* mutable_scripts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Script >*
+      mutable_scripts();
+  private:
+  const ::proto::Script& _internal_scripts(int index) const;
+  ::proto::Script* _internal_add_scripts();
+  public:
+  const ::proto::Script& scripts(int index) const;
+  ::proto::Script* add_scripts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Script >&
+      scripts() const;
+
+  // @@protoc_insertion_point(class_scope:proto.CellMap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellMap_Coord > coords_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Script > scripts_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cell_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Script
+
+// required .proto.ivec2 min = 1;
+inline bool Script::_internal_has_min() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.min_ != nullptr);
+  return value;
+}
+inline bool Script::has_min() const {
+  return _internal_has_min();
+}
+inline const ::proto::ivec2& Script::_internal_min() const {
+  const ::proto::ivec2* p = _impl_.min_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::ivec2&>(
+      ::proto::_ivec2_default_instance_);
+}
+inline const ::proto::ivec2& Script::min() const {
+  // @@protoc_insertion_point(field_get:proto.Script.min)
+  return _internal_min();
+}
+inline void Script::unsafe_arena_set_allocated_min(
+    ::proto::ivec2* min) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.min_);
+  }
+  _impl_.min_ = min;
+  if (min) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Script.min)
+}
+inline ::proto::ivec2* Script::release_min() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::proto::ivec2* temp = _impl_.min_;
+  _impl_.min_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::ivec2* Script::unsafe_arena_release_min() {
+  // @@protoc_insertion_point(field_release:proto.Script.min)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::proto::ivec2* temp = _impl_.min_;
+  _impl_.min_ = nullptr;
+  return temp;
+}
+inline ::proto::ivec2* Script::_internal_mutable_min() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.min_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::ivec2>(GetArenaForAllocation());
+    _impl_.min_ = p;
+  }
+  return _impl_.min_;
+}
+inline ::proto::ivec2* Script::mutable_min() {
+  ::proto::ivec2* _msg = _internal_mutable_min();
+  // @@protoc_insertion_point(field_mutable:proto.Script.min)
+  return _msg;
+}
+inline void Script::set_allocated_min(::proto::ivec2* min) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.min_);
+  }
+  if (min) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(min));
+    if (message_arena != submessage_arena) {
+      min = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, min, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.min_ = min;
+  // @@protoc_insertion_point(field_set_allocated:proto.Script.min)
+}
+
+// required .proto.ivec2 max = 2;
+inline bool Script::_internal_has_max() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.max_ != nullptr);
+  return value;
+}
+inline bool Script::has_max() const {
+  return _internal_has_max();
+}
+inline const ::proto::ivec2& Script::_internal_max() const {
+  const ::proto::ivec2* p = _impl_.max_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::ivec2&>(
+      ::proto::_ivec2_default_instance_);
+}
+inline const ::proto::ivec2& Script::max() const {
+  // @@protoc_insertion_point(field_get:proto.Script.max)
+  return _internal_max();
+}
+inline void Script::unsafe_arena_set_allocated_max(
+    ::proto::ivec2* max) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.max_);
+  }
+  _impl_.max_ = max;
+  if (max) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Script.max)
+}
+inline ::proto::ivec2* Script::release_max() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::proto::ivec2* temp = _impl_.max_;
+  _impl_.max_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::ivec2* Script::unsafe_arena_release_max() {
+  // @@protoc_insertion_point(field_release:proto.Script.max)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::proto::ivec2* temp = _impl_.max_;
+  _impl_.max_ = nullptr;
+  return temp;
+}
+inline ::proto::ivec2* Script::_internal_mutable_max() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.max_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::ivec2>(GetArenaForAllocation());
+    _impl_.max_ = p;
+  }
+  return _impl_.max_;
+}
+inline ::proto::ivec2* Script::mutable_max() {
+  ::proto::ivec2* _msg = _internal_mutable_max();
+  // @@protoc_insertion_point(field_mutable:proto.Script.max)
+  return _msg;
+}
+inline void Script::set_allocated_max(::proto::ivec2* max) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.max_);
+  }
+  if (max) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(max));
+    if (message_arena != submessage_arena) {
+      max = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, max, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.max_ = max;
+  // @@protoc_insertion_point(field_set_allocated:proto.Script.max)
+}
+
+// required string path = 3;
+inline bool Script::_internal_has_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Script::has_path() const {
+  return _internal_has_path();
+}
+inline void Script::clear_path() {
+  _impl_.path_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Script::path() const {
+  // @@protoc_insertion_point(field_get:proto.Script.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Script::set_path(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Script.path)
+}
+inline std::string* Script::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:proto.Script.path)
+  return _s;
+}
+inline const std::string& Script::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void Script::_internal_set_path(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Script::_internal_mutable_path() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Script::release_path() {
+  // @@protoc_insertion_point(field_release:proto.Script.path)
+  if (!_internal_has_path()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.path_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Script::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Script.path)
+}
+
+// optional string id = 4;
+inline bool Script::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Script::has_id() const {
+  return _internal_has_id();
+}
+inline void Script::clear_id() {
+  _impl_.id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Script::id() const {
+  // @@protoc_insertion_point(field_get:proto.Script.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Script::set_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Script.id)
+}
+inline std::string* Script::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:proto.Script.id)
+  return _s;
+}
+inline const std::string& Script::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void Script::_internal_set_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Script::_internal_mutable_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Script::release_id() {
+  // @@protoc_insertion_point(field_release:proto.Script.id)
+  if (!_internal_has_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Script::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Script.id)
+}
+
+// -------------------------------------------------------------------
+
+// Tileset
+
+// repeated uint32 collision = 1;
+inline int Tileset::_internal_collision_size() const {
+  return _impl_.collision_.size();
+}
+inline int Tileset::collision_size() const {
+  return _internal_collision_size();
+}
+inline void Tileset::clear_collision() {
+  _impl_.collision_.Clear();
+}
+inline uint32_t Tileset::_internal_collision(int index) const {
+  return _impl_.collision_.Get(index);
+}
+inline uint32_t Tileset::collision(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Tileset.collision)
+  return _internal_collision(index);
+}
+inline void Tileset::set_collision(int index, uint32_t value) {
+  _impl_.collision_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.Tileset.collision)
+}
+inline void Tileset::_internal_add_collision(uint32_t value) {
+  _impl_.collision_.Add(value);
+}
+inline void Tileset::add_collision(uint32_t value) {
+  _internal_add_collision(value);
+  // @@protoc_insertion_point(field_add:proto.Tileset.collision)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Tileset::_internal_collision() const {
+  return _impl_.collision_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Tileset::collision() const {
+  // @@protoc_insertion_point(field_list:proto.Tileset.collision)
+  return _internal_collision();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Tileset::_internal_mutable_collision() {
+  return &_impl_.collision_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Tileset::mutable_collision() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Tileset.collision)
+  return _internal_mutable_collision();
+}
+
+// -------------------------------------------------------------------
+
+// CellBlueprint_Tile
+
+// required int32 tileset = 1;
+inline bool CellBlueprint_Tile::_internal_has_tileset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CellBlueprint_Tile::has_tileset() const {
+  return _internal_has_tileset();
+}
+inline void CellBlueprint_Tile::clear_tileset() {
+  _impl_.tileset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CellBlueprint_Tile::_internal_tileset() const {
+  return _impl_.tileset_;
+}
+inline int32_t CellBlueprint_Tile::tileset() const {
+  // @@protoc_insertion_point(field_get:proto.CellBlueprint.Tile.tileset)
+  return _internal_tileset();
+}
+inline void CellBlueprint_Tile::_internal_set_tileset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tileset_ = value;
+}
+inline void CellBlueprint_Tile::set_tileset(int32_t value) {
+  _internal_set_tileset(value);
+  // @@protoc_insertion_point(field_set:proto.CellBlueprint.Tile.tileset)
+}
+
+// required int32 index = 2;
+inline bool CellBlueprint_Tile::_internal_has_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CellBlueprint_Tile::has_index() const {
+  return _internal_has_index();
+}
+inline void CellBlueprint_Tile::clear_index() {
+  _impl_.index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CellBlueprint_Tile::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t CellBlueprint_Tile::index() const {
+  // @@protoc_insertion_point(field_get:proto.CellBlueprint.Tile.index)
+  return _internal_index();
+}
+inline void CellBlueprint_Tile::_internal_set_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.index_ = value;
+}
+inline void CellBlueprint_Tile::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:proto.CellBlueprint.Tile.index)
+}
+
+// -------------------------------------------------------------------
+
+// CellBlueprint
+
+// repeated string tilesets = 1;
+inline int CellBlueprint::_internal_tilesets_size() const {
+  return _impl_.tilesets_.size();
+}
+inline int CellBlueprint::tilesets_size() const {
+  return _internal_tilesets_size();
+}
+inline void CellBlueprint::clear_tilesets() {
+  _impl_.tilesets_.Clear();
+}
+inline std::string* CellBlueprint::add_tilesets() {
+  std::string* _s = _internal_add_tilesets();
+  // @@protoc_insertion_point(field_add_mutable:proto.CellBlueprint.tilesets)
+  return _s;
+}
+inline const std::string& CellBlueprint::_internal_tilesets(int index) const {
+  return _impl_.tilesets_.Get(index);
+}
+inline const std::string& CellBlueprint::tilesets(int index) const {
+  // @@protoc_insertion_point(field_get:proto.CellBlueprint.tilesets)
+  return _internal_tilesets(index);
+}
+inline std::string* CellBlueprint::mutable_tilesets(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.CellBlueprint.tilesets)
+  return _impl_.tilesets_.Mutable(index);
+}
+inline void CellBlueprint::set_tilesets(int index, const std::string& value) {
+  _impl_.tilesets_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto.CellBlueprint.tilesets)
+}
+inline void CellBlueprint::set_tilesets(int index, std::string&& value) {
+  _impl_.tilesets_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto.CellBlueprint.tilesets)
+}
+inline void CellBlueprint::set_tilesets(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.tilesets_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto.CellBlueprint.tilesets)
+}
+inline void CellBlueprint::set_tilesets(int index, const char* value, size_t size) {
+  _impl_.tilesets_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto.CellBlueprint.tilesets)
+}
+inline std::string* CellBlueprint::_internal_add_tilesets() {
+  return _impl_.tilesets_.Add();
+}
+inline void CellBlueprint::add_tilesets(const std::string& value) {
+  _impl_.tilesets_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto.CellBlueprint.tilesets)
+}
+inline void CellBlueprint::add_tilesets(std::string&& value) {
+  _impl_.tilesets_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto.CellBlueprint.tilesets)
+}
+inline void CellBlueprint::add_tilesets(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.tilesets_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto.CellBlueprint.tilesets)
+}
+inline void CellBlueprint::add_tilesets(const char* value, size_t size) {
+  _impl_.tilesets_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto.CellBlueprint.tilesets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CellBlueprint::tilesets() const {
+  // @@protoc_insertion_point(field_list:proto.CellBlueprint.tilesets)
+  return _impl_.tilesets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CellBlueprint::mutable_tilesets() {
+  // @@protoc_insertion_point(field_mutable_list:proto.CellBlueprint.tilesets)
+  return &_impl_.tilesets_;
+}
+
+// repeated .proto.CellBlueprint.Tile tiles = 2;
+inline int CellBlueprint::_internal_tiles_size() const {
+  return _impl_.tiles_.size();
+}
+inline int CellBlueprint::tiles_size() const {
+  return _internal_tiles_size();
+}
+inline void CellBlueprint::clear_tiles() {
+  _impl_.tiles_.Clear();
+}
+inline ::proto::CellBlueprint_Tile* CellBlueprint::mutable_tiles(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.CellBlueprint.tiles)
+  return _impl_.tiles_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellBlueprint_Tile >*
+CellBlueprint::mutable_tiles() {
+  // @@protoc_insertion_point(field_mutable_list:proto.CellBlueprint.tiles)
+  return &_impl_.tiles_;
+}
+inline const ::proto::CellBlueprint_Tile& CellBlueprint::_internal_tiles(int index) const {
+  return _impl_.tiles_.Get(index);
+}
+inline const ::proto::CellBlueprint_Tile& CellBlueprint::tiles(int index) const {
+  // @@protoc_insertion_point(field_get:proto.CellBlueprint.tiles)
+  return _internal_tiles(index);
+}
+inline ::proto::CellBlueprint_Tile* CellBlueprint::_internal_add_tiles() {
+  return _impl_.tiles_.Add();
+}
+inline ::proto::CellBlueprint_Tile* CellBlueprint::add_tiles() {
+  ::proto::CellBlueprint_Tile* _add = _internal_add_tiles();
+  // @@protoc_insertion_point(field_add:proto.CellBlueprint.tiles)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellBlueprint_Tile >&
+CellBlueprint::tiles() const {
+  // @@protoc_insertion_point(field_list:proto.CellBlueprint.tiles)
+  return _impl_.tiles_;
+}
+
+// -------------------------------------------------------------------
+
+// CellMap_Coord
+
+// required .proto.ivec2 coord = 1;
+inline bool CellMap_Coord::_internal_has_coord() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.coord_ != nullptr);
+  return value;
+}
+inline bool CellMap_Coord::has_coord() const {
+  return _internal_has_coord();
+}
+inline const ::proto::ivec2& CellMap_Coord::_internal_coord() const {
+  const ::proto::ivec2* p = _impl_.coord_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::ivec2&>(
+      ::proto::_ivec2_default_instance_);
+}
+inline const ::proto::ivec2& CellMap_Coord::coord() const {
+  // @@protoc_insertion_point(field_get:proto.CellMap.Coord.coord)
+  return _internal_coord();
+}
+inline void CellMap_Coord::unsafe_arena_set_allocated_coord(
+    ::proto::ivec2* coord) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.coord_);
+  }
+  _impl_.coord_ = coord;
+  if (coord) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.CellMap.Coord.coord)
+}
+inline ::proto::ivec2* CellMap_Coord::release_coord() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto::ivec2* temp = _impl_.coord_;
+  _impl_.coord_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::ivec2* CellMap_Coord::unsafe_arena_release_coord() {
+  // @@protoc_insertion_point(field_release:proto.CellMap.Coord.coord)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::proto::ivec2* temp = _impl_.coord_;
+  _impl_.coord_ = nullptr;
+  return temp;
+}
+inline ::proto::ivec2* CellMap_Coord::_internal_mutable_coord() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.coord_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::ivec2>(GetArenaForAllocation());
+    _impl_.coord_ = p;
+  }
+  return _impl_.coord_;
+}
+inline ::proto::ivec2* CellMap_Coord::mutable_coord() {
+  ::proto::ivec2* _msg = _internal_mutable_coord();
+  // @@protoc_insertion_point(field_mutable:proto.CellMap.Coord.coord)
+  return _msg;
+}
+inline void CellMap_Coord::set_allocated_coord(::proto::ivec2* coord) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.coord_);
+  }
+  if (coord) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(coord));
+    if (message_arena != submessage_arena) {
+      coord = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, coord, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.coord_ = coord;
+  // @@protoc_insertion_point(field_set_allocated:proto.CellMap.Coord.coord)
+}
+
+// required string cell = 2;
+inline bool CellMap_Coord::_internal_has_cell() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CellMap_Coord::has_cell() const {
+  return _internal_has_cell();
+}
+inline void CellMap_Coord::clear_cell() {
+  _impl_.cell_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CellMap_Coord::cell() const {
+  // @@protoc_insertion_point(field_get:proto.CellMap.Coord.cell)
+  return _internal_cell();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CellMap_Coord::set_cell(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.cell_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.CellMap.Coord.cell)
+}
+inline std::string* CellMap_Coord::mutable_cell() {
+  std::string* _s = _internal_mutable_cell();
+  // @@protoc_insertion_point(field_mutable:proto.CellMap.Coord.cell)
+  return _s;
+}
+inline const std::string& CellMap_Coord::_internal_cell() const {
+  return _impl_.cell_.Get();
+}
+inline void CellMap_Coord::_internal_set_cell(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cell_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CellMap_Coord::_internal_mutable_cell() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.cell_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CellMap_Coord::release_cell() {
+  // @@protoc_insertion_point(field_release:proto.CellMap.Coord.cell)
+  if (!_internal_has_cell()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.cell_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cell_.IsDefault()) {
+    _impl_.cell_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CellMap_Coord::set_allocated_cell(std::string* cell) {
+  if (cell != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.cell_.SetAllocated(cell, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cell_.IsDefault()) {
+    _impl_.cell_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.CellMap.Coord.cell)
+}
+
+// -------------------------------------------------------------------
+
+// CellMap
+
+// repeated .proto.CellMap.Coord coords = 1;
+inline int CellMap::_internal_coords_size() const {
+  return _impl_.coords_.size();
+}
+inline int CellMap::coords_size() const {
+  return _internal_coords_size();
+}
+inline void CellMap::clear_coords() {
+  _impl_.coords_.Clear();
+}
+inline ::proto::CellMap_Coord* CellMap::mutable_coords(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.CellMap.coords)
+  return _impl_.coords_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellMap_Coord >*
+CellMap::mutable_coords() {
+  // @@protoc_insertion_point(field_mutable_list:proto.CellMap.coords)
+  return &_impl_.coords_;
+}
+inline const ::proto::CellMap_Coord& CellMap::_internal_coords(int index) const {
+  return _impl_.coords_.Get(index);
+}
+inline const ::proto::CellMap_Coord& CellMap::coords(int index) const {
+  // @@protoc_insertion_point(field_get:proto.CellMap.coords)
+  return _internal_coords(index);
+}
+inline ::proto::CellMap_Coord* CellMap::_internal_add_coords() {
+  return _impl_.coords_.Add();
+}
+inline ::proto::CellMap_Coord* CellMap::add_coords() {
+  ::proto::CellMap_Coord* _add = _internal_add_coords();
+  // @@protoc_insertion_point(field_add:proto.CellMap.coords)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::CellMap_Coord >&
+CellMap::coords() const {
+  // @@protoc_insertion_point(field_list:proto.CellMap.coords)
+  return _impl_.coords_;
+}
+
+// repeated .proto.Script scripts = 2;
+inline int CellMap::_internal_scripts_size() const {
+  return _impl_.scripts_.size();
+}
+inline int CellMap::scripts_size() const {
+  return _internal_scripts_size();
+}
+inline void CellMap::clear_scripts() {
+  _impl_.scripts_.Clear();
+}
+inline ::proto::Script* CellMap::mutable_scripts(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.CellMap.scripts)
+  return _impl_.scripts_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Script >*
+CellMap::mutable_scripts() {
+  // @@protoc_insertion_point(field_mutable_list:proto.CellMap.scripts)
+  return &_impl_.scripts_;
+}
+inline const ::proto::Script& CellMap::_internal_scripts(int index) const {
+  return _impl_.scripts_.Get(index);
+}
+inline const ::proto::Script& CellMap::scripts(int index) const {
+  // @@protoc_insertion_point(field_get:proto.CellMap.scripts)
+  return _internal_scripts(index);
+}
+inline ::proto::Script* CellMap::_internal_add_scripts() {
+  return _impl_.scripts_.Add();
+}
+inline ::proto::Script* CellMap::add_scripts() {
+  ::proto::Script* _add = _internal_add_scripts();
+  // @@protoc_insertion_point(field_add:proto.CellMap.scripts)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Script >&
+CellMap::scripts() const {
+  // @@protoc_insertion_point(field_list:proto.CellMap.scripts)
+  return _impl_.scripts_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_cell_2eproto
@@ -0,0 +1,306 @@
+#include "../data/bank.h"
+#include "../data/cell.h"
+#include "../data/tileset.h"
+#include "../filesystem/physical.h"
+#include "../game/lighting.h"
+#include "../game/stage.h"
+#include "../render/gl_util.h"
+#include "../render/util.h"
+#include "../render/window.h"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+// Standalone benchmark for the lighting algorithms. Loads a map, replaces its
+// lights with a configurable set of point, cone and planar lights scattered
+// over the active window, and times Lighting::recalculate_traces() with a cold
+// cache, a warm cache, and with every light moving each frame. Each frame also
+// renders a lightbuffer so that the cost of building the light meshes (which
+// includes cutting cone traces) can be measured, but everything except that
+// column is CPU-only.
+namespace {
+
+typedef std::chrono::high_resolution_clock hrclock;
+
+struct bench_config {
+  std::size_t points;
+  std::size_t cones;
+  std::size_t planars;
+  std::size_t frames;
+  y::world range;
+};
+
+struct bench_light {
+  Script* script;
+  Light* light;
+  y::wvec2 velocity;
+};
+
+enum bench_mode {
+  BENCH_COLD,
+  BENCH_WARM,
+  BENCH_MOVING,
+};
+
+// Sums of the per-frame statistics over a run.
+struct bench_totals {
+  bench_totals();
+
+  std::size_t frames;
+  std::size_t lights;
+  std::size_t traced;
+  std::size_t trace_vertices;
+  std::size_t ns_total;
+  std::size_t ns_query;
+  std::size_t ns_sort;
+  std::size_t ns_sweep;
+  std::size_t ns_cone;
+  std::size_t ns_render;
+};
+
+bench_totals::bench_totals()
+  : frames(0)
+  , lights(0)
+  , traced(0)
+  , trace_vertices(0)
+  , ns_total(0)
+  , ns_query(0)
+  , ns_sort(0)
+  , ns_sweep(0)
+  , ns_cone(0)
+  , ns_render(0)
+{
+}
+
+std::size_t elapsed_ns(const hrclock::time_point& start,
+                       const hrclock::time_point& end)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      end - start).count();
+}
+
+double per_frame_ms(std::size_t ns, std::size_t frames)
+{
+  return frames ? double(ns) / (1000000. * frames) : 0.;
+}
+
+void create_lights(std::vector<bench_light>& output, GameStage& stage,
+                   const LuaFile& file, const bench_config& config,
+                   const y::wvec2& min, const y::wvec2& max,
+                   std::mt19937& generator)
+{
+  std::uniform_real_distribution<y::world> x_pos(min[xx], max[xx]);
+  std::uniform_real_distribution<y::world> y_pos(min[yy], max[yy]);
+  std::uniform_real_distribution<y::world> angle(-y::pi, y::pi);
+  std::uniform_real_distribution<y::world> speed(-4., 4.);
+
+  std::size_t total = config.points + config.cones + config.planars;
+  for (std::size_t i = 0; i < total; ++i) {
+    Script& script = stage.get_scripts().create_script(
+        file, y::wvec2{x_pos(generator), y_pos(generator)});
+    Light* light = stage.get_lighting().create_obj(script);
+    light->full_range = config.range / 2;
+    light->falloff_range = config.range / 2;
+
+    if (i >= config.points && i < config.points + config.cones) {
+      light->angle = angle(generator);
+      light->aperture = y::pi / 4;
+    }
+    else if (i >= config.points + config.cones) {
+      y::world a = angle(generator);
+      light->normal_vec = y::wvec2{std::cos(a), std::sin(a)};
+      light->offset =
+          y::wvec2{-std::sin(a), std::cos(a)} * (config.range / 4);
+    }
+    output.push_back(bench_light{
+        &script, light, y::wvec2{speed(generator), speed(generator)}});
+  }
+}
+
+void move_lights(std::vector<bench_light>& lights,
+                 const y::wvec2& min, const y::wvec2& max)
+{
+  for (bench_light& b : lights) {
+    y::wvec2 origin = b.script->get_origin() + b.velocity;
+    for (std::size_t i = 0; i < 2; ++i) {
+      if (origin[i] < min[i] || origin[i] >= max[i]) {
+        b.velocity[i] = -b.velocity[i];
+        origin[i] += 2 * b.velocity[i];
+      }
+    }
+    b.script->set_origin(origin);
+    b.light->angle = y::angle(b.light->angle + y::pi / 64);
+  }
+}
+
+void run(bench_totals& output, bench_mode mode,
+         Lighting& lighting, std::vector<bench_light>& lights,
+         RenderUtil& util, const GlFramebuffer& normalbuffer,
+         const GlFramebuffer& lightbuffer,
+         const y::wvec2& min, const y::wvec2& max, std::size_t frames)
+{
+  lighting.clear_results_and_cache();
+  if (mode != BENCH_COLD) {
+    lighting.recalculate_traces(min, max);
+  }
+
+  for (std::size_t i = 0; i < frames; ++i) {
+    if (mode == BENCH_COLD) {
+      lighting.clear_results_and_cache();
+    }
+    else if (mode == BENCH_MOVING) {
+      move_lights(lights, min, max);
+    }
+
+    hrclock::time_point start = hrclock::now();
+    lighting.recalculate_traces(min, max);
+    hrclock::time_point end = hrclock::now();
+
+    lightbuffer.bind(true, true);
+    lighting.render_lightbuffer(util, normalbuffer, min, max);
+    glFinish();
+    hrclock::time_point render_end = hrclock::now();
+
+    const Lighting::trace_stats& stats = lighting.get_trace_stats();
+    ++output.frames;
+    output.lights += stats.lights;
+    output.traced += stats.traced;
+    output.trace_vertices += stats.trace_vertices;
+    output.ns_total += elapsed_ns(start, end);
+    output.ns_query += stats.ns_query;
+    output.ns_sort += stats.ns_sort;
+    output.ns_sweep += stats.ns_sweep;
+    output.ns_cone += stats.ns_cone;
+    output.ns_render += elapsed_ns(end, render_end);
+  }
+}
+
+void print_header()
+{
+  std::cout << std::left << std::setw(8) << "mode" << std::right <<
+      std::setw(8) << "lights" << std::setw(8) << "traced" <<
+      std::setw(10) << "vertices" << std::setw(10) << "total" <<
+      std::setw(10) << "query" << std::setw(10) << "sort" <<
+      std::setw(10) << "sweep" << std::setw(10) << "cone" <<
+      std::setw(10) << "render" << std::endl;
+}
+
+void print_totals(const std::string& name, const bench_totals& t)
+{
+  std::size_t n = std::max(std::size_t(1), t.frames);
+  std::cout << std::left << std::setw(8) << name << std::right <<
+      std::setw(8) << t.lights / n << std::setw(8) << t.traced / n <<
+      std::setw(10) << t.trace_vertices / n << std::fixed <<
+      std::setprecision(3) <<
+      std::setw(10) << per_frame_ms(t.ns_total, t.frames) <<
+      std::setw(10) << per_frame_ms(t.ns_query, t.frames) <<
+      std::setw(10) << per_frame_ms(t.ns_sort, t.frames) <<
+      std::setw(10) << per_frame_ms(t.ns_sweep, t.frames) <<
+      std::setw(10) << per_frame_ms(t.ns_cone, t.frames) <<
+      std::setw(10) << per_frame_ms(t.ns_render, t.frames) << std::endl;
+}
+
+}
+
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  std::vector<std::string> args;
+  for (std::int32_t i = 1; i < argc; ++i) {
+    args.emplace_back(argv[i]);
+  }
+  // Usage: lighting_bench [map x y [points cones planars frames range]]
+  if (!args.empty() && args.size() != 3 && args.size() != 8) {
+    log_err("Usage: lighting_bench "
+            "[map x y [points cones planars frames range]]");
+    return 1;
+  }
+  bench_config config{64, 16, 8, 100, 256.};
+  if (args.size() == 8) {
+    config.points = std::stoul(args[3]);
+    config.cones = std::stoul(args[4]);
+    config.planars = std::stoul(args[5]);
+    config.frames = std::stoul(args[6]);
+    config.range = std::stod(args[7]);
+  }
+
+  // We still need a GL context for the Databank and GameStage, even though
+  // the traces themselves are computed entirely on the CPU.
+  Window window("Crunk Lighting Benchmark", 24, RenderUtil::native_size,
+                false, true);
+  PhysicalFilesystem data_filesystem("data");
+  GlUtil gl(data_filesystem, window);
+  if (!gl) {
+    return 1;
+  }
+  Databank databank(data_filesystem, gl, false, &data_filesystem);
+  RenderUtil util(gl);
+  util.set_resolution(RenderUtil::native_size);
+
+  std::string map = databank.maps.get_names()[0];
+  y::wvec2 world;
+  if (!args.empty()) {
+    if (databank.maps.is_name_used(args[0])) {
+      map = args[0];
+    }
+    y::ivec2 tile{std::stoi(args[1]), std::stoi(args[2])};
+    world = (y::wvec2{.5, .5} + y::wvec2(tile)) *
+             y::wvec2(Tileset::tile_size);
+  }
+
+  GlUnique<GlFramebuffer> framebuffer(gl.make_unique_framebuffer(
+      RenderUtil::native_size, false, true));
+  GlUnique<GlFramebuffer> normalbuffer(gl.make_unique_framebuffer(
+      RenderUtil::native_size, false, true));
+  GlUnique<GlFramebuffer> lightbuffer(gl.make_unique_framebuffer(
+      RenderUtil::native_size, false, true));
+
+  PhysicalFilesystem save_filesystem("save");
+  GameStage stage(databank, save_filesystem, util, *framebuffer,
+                  map, world, true);
+  Lighting& lighting = stage.get_lighting();
+
+  // Get rid of any lights created by the map's own scripts so that only the
+  // benchmark lights are measured.
+  Lighting::source_list sources;
+  lighting.get_sources(sources);
+  for (const Script* s : sources) {
+    lighting.destroy_all(*s);
+  }
+
+  // Scatter the lights over the whole active window.
+  const y::wvec2 cell_pixels =
+      y::wvec2(Cell::cell_size * Tileset::tile_size);
+  const y::world half_size = WorldWindow::active_window_half_size;
+  const y::wvec2 min = -half_size * cell_pixels;
+  const y::wvec2 max = (1 + half_size) * cell_pixels;
+
+  LuaFile file;
+  file.path = "/bench/light.lua";
+  std::mt19937 generator(0);
+  std::vector<bench_light> lights;
+  create_lights(lights, stage, file, config, min, max, generator);
+
+  std::cout << "Map " << map << ": " << config.points << " point, " <<
+      config.cones << " cone, " << config.planars << " planar lights; " <<
+      config.frames << " frames; times are ms per frame" << std::endl;
+  print_header();
+
+  bench_totals cold;
+  run(cold, BENCH_COLD, lighting, lights, util,
+      *normalbuffer, *lightbuffer, min, max, config.frames);
+  print_totals("cold", cold);
+
+  bench_totals warm;
+  run(warm, BENCH_WARM, lighting, lights, util,
+      *normalbuffer, *lightbuffer, min, max, config.frames);
+  print_totals("warm", warm);
+
+  bench_totals moving;
+  run(moving, BENCH_MOVING, lighting, lights, util,
+      *normalbuffer, *lightbuffer, min, max, config.frames);
+  print_totals("moving", moving);
+  return 0;
+}
@@ -0,0 +1,136 @@
+#include "../game/savegame.h"
+#include "../lua_types.h"
+#include "../log.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+// Standalone benchmark for LuaValue. Counts heap allocations and times the
+// operations that scripts lean on: building and copying argument lists,
+// converting values to and from Lua, and storing them in the Savegame. Only
+// uses the parts of LuaValue that have been stable, so the same file can be
+// built against older versions for comparison.
+namespace {
+
+typedef std::chrono::high_resolution_clock hrclock;
+typedef std::vector<LuaValue> value_list;
+
+std::size_t allocations = 0;
+
+struct bench_result {
+  std::size_t allocations;
+  std::size_t ns;
+};
+
+bench_result run(std::size_t count, const std::function<void()>& operation)
+{
+  std::size_t allocations_before = allocations;
+  hrclock::time_point start = hrclock::now();
+  for (std::size_t i = 0; i < count; ++i) {
+    operation();
+  }
+  hrclock::time_point end = hrclock::now();
+  return bench_result{
+      allocations - allocations_before,
+      std::size_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+          end - start).count())};
+}
+
+void print_header()
+{
+  std::cout << std::left << std::setw(12) << "operation" << std::right <<
+      std::setw(12) << "allocs/op" << std::setw(12) << "ns/op" << std::endl;
+}
+
+void print_result(const std::string& name, std::size_t count,
+                  const bench_result& r)
+{
+  std::cout << std::left << std::setw(12) << name << std::right <<
+      std::fixed << std::setprecision(3) <<
+      std::setw(12) << double(r.allocations) / count <<
+      std::setw(12) << double(r.ns) / count << std::endl;
+}
+
+}
+
+// Count every allocation. The default deallocation functions release memory
+// with free(), so only allocation needs replacing.
+void* operator new(std::size_t size)
+{
+  ++allocations;
+  void* p = std::malloc(size ? size : 1);
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  // Usage: lua_value_bench [count]
+  if (argc > 2) {
+    log_err("Usage: lua_value_bench [count]");
+    return 1;
+  }
+  std::size_t count = argc == 2 ? std::stoul(argv[1]) : 100000;
+
+  value_list array;
+  for (std::size_t i = 0; i < 8; ++i) {
+    array.emplace_back(y::world(i));
+  }
+  const value_list scalars{LuaValue(y::world(1)), LuaValue(true)};
+  const value_list strings{LuaValue(std::string("on_submerge")),
+                           LuaValue(std::string(64, 'a'))};
+  const value_list arrays{LuaValue(array)};
+
+  lua_State* state = luaL_newstate();
+  LuaType<LuaValue> t;
+  Savegame savegame;
+  const LuaValue saved(array);
+
+  std::cout << "LuaValue: " << count << " operations each" << std::endl;
+  print_header();
+
+  print_result("scalars", count, run(count, [&]()
+  {
+    value_list args;
+    args.emplace_back(y::world(1));
+    args.emplace_back(true);
+    value_list copy(args);
+  }));
+  print_result("strings", count, run(count, [&]()
+  {
+    value_list copy(strings);
+  }));
+  print_result("arrays", count, run(count, [&]()
+  {
+    value_list copy(arrays);
+  }));
+  print_result("round trip", count, run(count, [&]()
+  {
+    for (const LuaValue& v : scalars) {
+      t.push(state, v);
+    }
+    for (const LuaValue& v : strings) {
+      t.push(state, v);
+    }
+    t.push(state, arrays[0]);
+    value_list output;
+    for (lua_int i = 1; i <= lua_gettop(state); ++i) {
+      output.emplace_back(t.get(state, i));
+    }
+    lua_settop(state, 0);
+  }));
+  print_result("savegame", count, run(count, [&]()
+  {
+    savegame.put("key", saved);
+    LuaValue v(savegame.get("key"));
+  }));
+
+  lua_close(state);
+  return 0;
+}
@@ -0,0 +1,183 @@
+#include "../data/bank.h"
+#include "../filesystem/physical.h"
+#include "../game/stage.h"
+#include "../lua.h"
+#include "../render/gl_util.h"
+#include "../render/util.h"
+#include "../render/window.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// Standalone benchmark for Script creation. Creates a number of copies of a
+// script, each either with a Lua state of its own or in its own environment in
+// the GameStage's shared state, and reports the creation time and memory used
+// per script, and the time to call update() on all of them. Scripts in the
+// shared state are created both from source and from precompiled bytecode.
+namespace {
+
+typedef std::chrono::high_resolution_clock hrclock;
+typedef std::vector<std::unique_ptr<Script>> script_list;
+
+enum bench_mode {
+  BENCH_OWN,
+  BENCH_SOURCE,
+  BENCH_SHARED,
+};
+
+struct bench_totals {
+  bench_totals();
+
+  std::size_t scripts;
+  std::size_t frames;
+  std::size_t bytes;
+  std::size_t ns_create;
+  std::size_t ns_update;
+};
+
+bench_totals::bench_totals()
+  : scripts(0)
+  , frames(0)
+  , bytes(0)
+  , ns_create(0)
+  , ns_update(0)
+{
+}
+
+std::size_t elapsed_ns(const hrclock::time_point& start,
+                       const hrclock::time_point& end)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      end - start).count();
+}
+
+std::size_t collected_memory(const LuaVm& vm)
+{
+  lua_gc(vm.get_state(), LUA_GCCOLLECT, 0);
+  return vm.get_memory();
+}
+
+void run(bench_totals& output, bench_mode mode, GameStage& stage,
+         const LuaFile& file, std::size_t count, std::size_t frames)
+{
+  script_list scripts;
+  std::size_t shared_before = collected_memory(stage.get_lua());
+
+  hrclock::time_point start = hrclock::now();
+  for (std::size_t i = 0; i < count; ++i) {
+    y::wvec2 origin{y::world(32 * (i % 32)), y::world(32 * (i / 32))};
+    y::wvec2 region{32., 32.};
+    if (mode == BENCH_OWN) {
+      scripts.emplace_back(new Script(
+          stage, file.path, file.get_chunk(), origin, region));
+    }
+    else {
+      scripts.emplace_back(new Script(
+          stage.get_lua(), file.path,
+          mode == BENCH_SOURCE ? file.contents : file.get_chunk(),
+          origin, region));
+    }
+  }
+  hrclock::time_point end = hrclock::now();
+
+  if (mode == BENCH_OWN) {
+    for (const auto& script : scripts) {
+      output.bytes += collected_memory(script->get_vm());
+    }
+  }
+  else {
+    output.bytes += collected_memory(stage.get_lua()) - shared_before;
+  }
+
+  hrclock::time_point update_start = hrclock::now();
+  for (std::size_t i = 0; i < frames; ++i) {
+    for (const auto& script : scripts) {
+      script->call(Script::HOOK_UPDATE);
+    }
+  }
+  hrclock::time_point update_end = hrclock::now();
+
+  output.scripts += count;
+  output.frames += frames;
+  output.ns_create += elapsed_ns(start, end);
+  output.ns_update += elapsed_ns(update_start, update_end);
+}
+
+void print_header()
+{
+  std::cout << std::left << std::setw(8) << "mode" << std::right <<
+      std::setw(8) << "scripts" << std::setw(12) << "KiB/script" <<
+      std::setw(12) << "us/script" << std::setw(12) << "update ms" <<
+      std::endl;
+}
+
+void print_totals(const std::string& name, const bench_totals& t)
+{
+  std::size_t n = std::max(std::size_t(1), t.scripts);
+  std::cout << std::left << std::setw(8) << name << std::right <<
+      std::setw(8) << t.scripts << std::fixed << std::setprecision(3) <<
+      std::setw(12) << double(t.bytes) / (1024. * n) <<
+      std::setw(12) << double(t.ns_create) / (1000. * n) <<
+      std::setw(12) << (t.frames ?
+                        double(t.ns_update) / (1000000. * t.frames) : 0.) <<
+      std::endl;
+}
+
+}
+
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  std::vector<std::string> args;
+  for (std::int32_t i = 1; i < argc; ++i) {
+    args.emplace_back(argv[i]);
+  }
+  // Usage: script_bench [script [count frames]]
+  if (args.size() != 0 && args.size() != 1 && args.size() != 3) {
+    log_err("Usage: script_bench [script [count frames]]");
+    return 1;
+  }
+  std::string path = args.empty() ? "/scripts/game/crate.lua" : args[0];
+  std::size_t count = args.size() == 3 ? std::stoul(args[1]) : 500;
+  std::size_t frames = args.size() == 3 ? std::stoul(args[2]) : 100;
+
+  // The Databank and GameStage need a GL context, even though nothing is
+  // rendered.
+  Window window("Crunk Script Benchmark", 24, RenderUtil::native_size,
+                false, true);
+  PhysicalFilesystem data_filesystem("data");
+  GlUtil gl(data_filesystem, window);
+  if (!gl) {
+    return 1;
+  }
+  Databank databank(data_filesystem, gl, false, &data_filesystem);
+  RenderUtil util(gl);
+  if (!databank.scripts.is_name_used(path)) {
+    log_err("No such script ", path);
+    return 1;
+  }
+  const LuaFile& file = databank.scripts.get(path);
+
+  GlUnique<GlFramebuffer> framebuffer(gl.make_unique_framebuffer(
+      RenderUtil::native_size, false, true));
+  PhysicalFilesystem save_filesystem("save");
+  GameStage stage(databank, save_filesystem, util, *framebuffer,
+                  databank.maps.get_names()[0], y::wvec2(), true);
+
+  std::cout << "Script " << path << ": " << count << " scripts; " <<
+      frames << " update frames" << std::endl;
+  print_header();
+
+  bench_totals own;
+  run(own, BENCH_OWN, stage, file, count, frames);
+  print_totals("own", own);
+
+  bench_totals source;
+  run(source, BENCH_SOURCE, stage, file, count, frames);
+  print_totals("source", source);
+
+  bench_totals shared;
+  run(shared, BENCH_SHARED, stage, file, count, frames);
+  print_totals("shared", shared);
+  return 0;
+}
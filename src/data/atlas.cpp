@@ -0,0 +1,318 @@
+#include "atlas.h"
+
+#include "../filesystem/filesystem.h"
+#include "../render/gl_util.h"
+#include "../log.h"
+#include <algorithm>
+#include <cstring>
+#include <SFML/Graphics.hpp>
+
+namespace {
+
+  const std::string cache_path = "/atlas.cache";
+  const std::string cache_magic = "yatlas1";
+  // Largest page we'll make, if the implementation allows it.
+  const std::int32_t max_page_size = 2048;
+  // Space left between images, so that nothing can bleed across.
+  const std::int32_t padding = 1;
+
+  template<typename T>
+  void write_value(std::string& output, const T& t)
+  {
+    output.append(reinterpret_cast<const char*>(&t), sizeof(T));
+  }
+
+  template<typename T>
+  bool read_value(T& output, const std::string& input, std::size_t& offset)
+  {
+    if (offset + sizeof(T) > input.length()) {
+      return false;
+    }
+    std::memcpy(&output, input.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+  }
+
+  bool read_bytes(std::vector<GLubyte>& output, std::size_t length,
+                  const std::string& input, std::size_t& offset)
+  {
+    if (offset + length > input.length()) {
+      return false;
+    }
+    output.assign(input.data() + offset, input.data() + offset + length);
+    offset += length;
+    return true;
+  }
+
+  bool load_image(sf::Image& output, const Filesystem& filesystem,
+                  const std::string& path)
+  {
+    std::string data;
+    filesystem.read_file(data, path);
+    if (data.empty() || !output.loadFromMemory(data.data(), data.length())) {
+      log_err("Couldn't load image ", path);
+      return false;
+    }
+    return true;
+  }
+
+  y::ivec2 image_size(const sf::Image& image)
+  {
+    return y::ivec2{std::int32_t(image.getSize().x),
+                    std::int32_t(image.getSize().y)};
+  }
+
+  // Copy an image into the page at the given region, tiling it if it's smaller
+  // than the region (so that a mismatched normal map still covers the sprite).
+  void blit(std::vector<GLubyte>& page, const y::ivec2& page_size,
+            const sf::Image& image, const y::ivec2& origin,
+            const y::ivec2& size)
+  {
+    y::ivec2 source_size = image_size(image);
+    if (!(source_size > y::ivec2())) {
+      return;
+    }
+    const GLubyte* pixels = image.getPixelsPtr();
+    for (std::int32_t y = 0; y < size[yy]; ++y) {
+      GLubyte* row = &page[4 * ((origin[yy] + y) * page_size[xx] +
+                                origin[xx])];
+      const GLubyte* source_row =
+          pixels + 4 * (y % source_size[yy]) * source_size[xx];
+      for (std::int32_t x = 0; x < size[xx]; x += source_size[xx]) {
+        std::int32_t width = std::min(source_size[xx], size[xx] - x);
+        std::memcpy(row + 4 * x, source_row, 4 * width);
+      }
+    }
+  }
+
+}
+
+TextureAtlas::TextureAtlas()
+{
+}
+
+std::size_t TextureAtlas::add(const std::string& path,
+                              const std::string& normal_path)
+{
+  _sources.push_back(source{path, normal_path, 0});
+  _regions.push_back(region{false, 0, y::ivec2()});
+  return _sources.size() - 1;
+}
+
+void TextureAtlas::build(const Filesystem& filesystem, Filesystem* cache,
+                         GlUtil& gl, const std::string& default_normal_path)
+{
+  GLint max_texture_size = 0;
+  glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size);
+  std::int32_t page_size = std::min(max_page_size, max_texture_size);
+
+  // The cache is keyed on the contents of every image, so that editing any of
+  // them invalidates it.
+  std::string default_normal_data;
+  filesystem.read_file(default_normal_data, default_normal_path);
+  for (source& s : _sources) {
+    std::string data;
+    std::string normal_data;
+    filesystem.read_file(data, s.path);
+    if (!s.normal_path.empty()) {
+      filesystem.read_file(normal_data, s.normal_path);
+    }
+    s.hash = std::hash<std::string>()(
+        s.path + '\0' + s.normal_path + '\0' + data + '\0' +
+        (s.normal_path.empty() ? default_normal_data : normal_data));
+  }
+
+  std::vector<page_data> pages;
+  if (!cache || !read_cache(pages, *cache, page_size)) {
+    log_debug("Building texture atlas");
+    pack(pages, filesystem, default_normal_path, page_size);
+    if (cache) {
+      write_cache(pages, *cache, page_size);
+    }
+  }
+
+  for (const page_data& p : pages) {
+    GlTexture2D texture = gl.make_texture<GLubyte>(
+        p.size, GL_RGBA8, GL_RGBA, p.texture.data());
+    GlTexture2D normal = gl.make_texture<GLubyte>(
+        p.size, GL_RGBA8, GL_RGBA, p.normal.data());
+    _textures.emplace_back(gl.make_unique(texture));
+    _textures.emplace_back(gl.make_unique(normal));
+    _pages.push_back(page{texture, normal});
+  }
+  log_debug("Texture atlas has ", _pages.size(), " pages");
+}
+
+const TextureAtlas::region& TextureAtlas::get_region(std::size_t index) const
+{
+  return _regions[index];
+}
+
+const TextureAtlas::page& TextureAtlas::get_page(std::size_t index) const
+{
+  return _pages[index];
+}
+
+std::size_t TextureAtlas::get_page_count() const
+{
+  return _pages.size();
+}
+
+bool TextureAtlas::read_cache(std::vector<page_data>& output,
+                              const Filesystem& cache, std::int32_t page_size)
+{
+  std::string data;
+  if (!cache.is_file(cache_path)) {
+    return false;
+  }
+  cache.read_file(data, cache_path);
+  if (data.compare(0, cache_magic.length(), cache_magic)) {
+    return false;
+  }
+  std::size_t offset = cache_magic.length();
+
+  std::int32_t cached_page_size;
+  std::uint64_t source_count;
+  if (!read_value(cached_page_size, data, offset) ||
+      !read_value(source_count, data, offset) ||
+      cached_page_size != page_size || source_count != _sources.size()) {
+    return false;
+  }
+  for (const source& s : _sources) {
+    std::uint64_t hash;
+    if (!read_value(hash, data, offset) || hash != s.hash) {
+      return false;
+    }
+  }
+
+  std::vector<region> regions;
+  for (std::size_t i = 0; i < _sources.size(); ++i) {
+    std::uint8_t packed;
+    std::uint64_t page;
+    y::ivec2 origin;
+    if (!read_value(packed, data, offset) || !read_value(page, data, offset) ||
+        !read_value(origin[xx], data, offset) ||
+        !read_value(origin[yy], data, offset)) {
+      return false;
+    }
+    regions.push_back(region{packed != 0, page, origin});
+  }
+
+  std::uint64_t page_count;
+  if (!read_value(page_count, data, offset)) {
+    return false;
+  }
+  std::vector<page_data> pages(page_count);
+  for (page_data& p : pages) {
+    if (!read_value(p.size[xx], data, offset) ||
+        !read_value(p.size[yy], data, offset)) {
+      return false;
+    }
+    std::size_t length = 4 * p.size[xx] * p.size[yy];
+    if (!read_bytes(p.texture, length, data, offset) ||
+        !read_bytes(p.normal, length, data, offset)) {
+      return false;
+    }
+  }
+
+  log_debug("Loaded texture atlas from cache");
+  _regions.swap(regions);
+  output.swap(pages);
+  return true;
+}
+
+void TextureAtlas::write_cache(const std::vector<page_data>& pages,
+                               Filesystem& cache, std::int32_t page_size) const
+{
+  std::string data = cache_magic;
+  write_value(data, page_size);
+  write_value(data, std::uint64_t(_sources.size()));
+  for (const source& s : _sources) {
+    write_value(data, std::uint64_t(s.hash));
+  }
+  for (const region& r : _regions) {
+    write_value(data, std::uint8_t(r.packed));
+    write_value(data, std::uint64_t(r.page));
+    write_value(data, r.origin[xx]);
+    write_value(data, r.origin[yy]);
+  }
+  write_value(data, std::uint64_t(pages.size()));
+  for (const page_data& p : pages) {
+    write_value(data, p.size[xx]);
+    write_value(data, p.size[yy]);
+    data.append(p.texture.begin(), p.texture.end());
+    data.append(p.normal.begin(), p.normal.end());
+  }
+  if (!cache.write_file(data, cache_path)) {
+    log_err("Couldn't write texture atlas cache");
+  }
+}
+
+void TextureAtlas::pack(std::vector<page_data>& output,
+                        const Filesystem& filesystem,
+                        const std::string& default_normal_path,
+                        std::int32_t page_size)
+{
+  sf::Image default_normal;
+  load_image(default_normal, filesystem, default_normal_path);
+
+  std::vector<sf::Image> images(_sources.size());
+  std::vector<sf::Image> normals(_sources.size());
+  std::vector<std::size_t> order;
+  for (std::size_t i = 0; i < _sources.size(); ++i) {
+    const source& s = _sources[i];
+    if (!load_image(images[i], filesystem, s.path) ||
+        (!s.normal_path.empty() &&
+         !load_image(normals[i], filesystem, s.normal_path))) {
+      continue;
+    }
+    y::ivec2 size = image_size(images[i]);
+    if (size[xx] <= page_size && size[yy] <= page_size) {
+      order.push_back(i);
+    }
+  }
+
+  // Shelf packing: place images left-to-right in rows, tallest first, and
+  // start a new page when a row no longer fits.
+  auto taller = [&](std::size_t a, std::size_t b)
+  {
+    return images[a].getSize().y > images[b].getSize().y;
+  };
+  std::stable_sort(order.begin(), order.end(), taller);
+
+  y::ivec2 shelf;
+  std::int32_t shelf_height = 0;
+  for (std::size_t i : order) {
+    y::ivec2 size = image_size(images[i]);
+    if (output.empty() || shelf[xx] + size[xx] > page_size) {
+      shelf = y::ivec2{0, output.empty() ? 0 : shelf[yy] + shelf_height};
+      shelf_height = 0;
+    }
+    if (output.empty() || shelf[yy] + size[yy] > page_size) {
+      output.emplace_back();
+      shelf = y::ivec2();
+      shelf_height = 0;
+    }
+
+    page_data& p = output.back();
+    _regions[i] = region{true, output.size() - 1, shelf};
+    p.size = y::max(p.size, shelf + size);
+    shelf[xx] += size[xx] + padding;
+    shelf_height = std::max(shelf_height, size[yy] + padding);
+  }
+
+  // Pages are trimmed to the space actually used.
+  for (page_data& p : output) {
+    p.texture.resize(4 * p.size[xx] * p.size[yy]);
+    p.normal.resize(4 * p.size[xx] * p.size[yy]);
+  }
+  for (std::size_t i : order) {
+    const region& r = _regions[i];
+    page_data& p = output[r.page];
+    y::ivec2 size = image_size(images[i]);
+    blit(p.texture, p.size, images[i], r.origin, size);
+    blit(p.normal, p.size,
+         _sources[i].normal_path.empty() ? default_normal : normals[i],
+         r.origin, size);
+  }
+}
@@ -0,0 +1,80 @@
+#ifndef DATA_ATLAS_H
+#define DATA_ATLAS_H
+
+#include "../render/gl_handle.h"
+#include "../vec.h"
+#include <string>
+#include <vector>
+
+class Filesystem;
+class GlUtil;
+
+// Packs images into a few large textures at load time, so that sprites from
+// different images can be drawn in the same batch. Normal maps are packed into
+// a parallel set of textures with the same layout. The packed pages are cached
+// on disk, keyed on the contents of the source images, so they only need to be
+// rebuilt when something changes.
+class TextureAtlas {
+public:
+
+  // Where an image was packed. Images too large for a page aren't packed.
+  struct region {
+    bool packed;
+    std::size_t page;
+    y::ivec2 origin;
+  };
+
+  struct page {
+    GlTexture2D texture;
+    GlTexture2D normal;
+  };
+
+  TextureAtlas();
+  TextureAtlas(const TextureAtlas&) = delete;
+  TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+  // Add an image to be packed, returning its index. If there's no normal map,
+  // the normal path should be empty and the default normal map is used.
+  std::size_t add(const std::string& path, const std::string& normal_path);
+
+  // Pack all the added images and upload the pages. If the cache filesystem
+  // is given, the result is read from or written to it.
+  void build(const Filesystem& filesystem, Filesystem* cache, GlUtil& gl,
+             const std::string& default_normal_path);
+
+  const region& get_region(std::size_t index) const;
+  const page& get_page(std::size_t index) const;
+  std::size_t get_page_count() const;
+
+private:
+
+  struct source {
+    std::string path;
+    std::string normal_path;
+    std::size_t hash;
+  };
+
+  struct page_data {
+    y::ivec2 size;
+    std::vector<GLubyte> texture;
+    std::vector<GLubyte> normal;
+  };
+
+  // Read the cache, if it's valid for the current sources.
+  bool read_cache(std::vector<page_data>& output, const Filesystem& cache,
+                  std::int32_t page_size);
+  void write_cache(const std::vector<page_data>& pages, Filesystem& cache,
+                   std::int32_t page_size) const;
+
+  // Decode the source images and pack them into pages.
+  void pack(std::vector<page_data>& output, const Filesystem& filesystem,
+            const std::string& default_normal_path, std::int32_t page_size);
+
+  std::vector<source> _sources;
+  std::vector<region> _regions;
+  std::vector<page> _pages;
+  std::vector<GlUnique<GlTexture2D>> _textures;
+
+};
+
+#endif
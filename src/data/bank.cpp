@@ -9,7 +9,18 @@
 #include "../render/gl_util.h"
 #include "../render/util.h"
 #include "../lua.h"
+#include "../../gen/proto/cache.pb.h"
 #include "../../gen/proto/cell.pb.h"
+#include <chrono>
+
+namespace {
+  const std::string script_cache_path = "/scripts.cache";
+}
+
+const std::string& LuaFile::get_chunk() const
+{
+  return bytecode.empty() ? contents : bytecode;
+}
 
 Databank::~Databank()
 {
@@ -17,7 +28,8 @@ Databank::~Databank()
 
 Databank::Databank()
   : _default_script(
-      new LuaFile{"/yedit/missing.lua", "", y::fvec4{1.f, 1.f, 1.f, 1.f}})
+      new LuaFile{"/yedit/missing.lua", "", "",
+                  y::fvec4{1.f, 1.f, 1.f, 1.f}})
   , _default_sprite(new Sprite())
   , _default_tileset(new Tileset(*_default_sprite))
   , _default_cell(new CellBlueprint())
@@ -34,11 +46,13 @@ Databank::Databank()
 }
 
 Databank::Databank(const Filesystem& filesystem, GlUtil& gl,
-                   bool load_yedit_data)
+                   bool load_yedit_data, Filesystem* cache)
   : _default_script(
-      new LuaFile{"/yedit/missing.lua", "", y::fvec4{1.f, 1.f, 1.f, 1.f}})
+      new LuaFile{"/yedit/missing.lua", "", "",
+                  y::fvec4{1.f, 1.f, 1.f, 1.f}})
   , _default_sprite(new Sprite{gl.make_texture("/yedit/missing.png"),
-                               gl.make_texture("/default_normal.png")})
+                               gl.make_texture("/default_normal.png"),
+                               {}, {}, {}})
   , _default_tileset(new Tileset(*_default_sprite))
   , _default_cell(new CellBlueprint())
   , _default_map(new CellMap())
@@ -53,6 +67,8 @@ Databank::Databank(const Filesystem& filesystem, GlUtil& gl,
   // Things should be loaded in order of dependence, so that the data can be
   // accessed while loading if necessary. For example, maps depend on cells
   // and scripts.
+  // Sprites and tilesets are also added to the atlas, in the same order.
+  std::vector<std::pair<Sprite*, Tileset*>> atlas_sprites;
   std::vector<std::string> paths;
   filesystem.list_pattern(paths, "/sprites/**.png");
   for (const std::string& s : paths) {
@@ -74,8 +90,10 @@ Databank::Databank(const Filesystem& filesystem, GlUtil& gl,
       _textures.emplace_back(gl.make_unique(normal_texture));
     }
 
-    sprites.insert(
-        s, std::unique_ptr<Sprite>(new Sprite{texture, normal_texture}));
+    Sprite* sprite = new Sprite{texture, normal_texture, {}, {}, {}};
+    sprites.insert(s, std::unique_ptr<Sprite>(sprite));
+    _atlas.add(s, filesystem.is_file(normal_path) ? normal_path : "");
+    atlas_sprites.emplace_back(sprite, nullptr);
   }
 
   // Tilesets are available as sprites as well.
@@ -101,14 +119,33 @@ Databank::Databank(const Filesystem& filesystem, GlUtil& gl,
       _textures.emplace_back(gl.make_unique(normal_texture));
     }
 
-    Tileset* tileset = new Tileset(Sprite{texture, normal_texture});
+    Sprite* sprite = new Sprite{texture, normal_texture, {}, {}, {}};
+    Tileset* tileset = new Tileset(*sprite);
     if (filesystem.exists(data_path)) {
       log_debug("Loading ", data_path);
       tileset->load(filesystem, *this, data_path);
     }
     tilesets.insert(data_path, std::unique_ptr<Tileset>(tileset));
-    sprites.insert(
-        s, std::unique_ptr<Sprite>(new Sprite{texture, normal_texture}));
+    sprites.insert(s, std::unique_ptr<Sprite>(sprite));
+    _atlas.add(s, filesystem.is_file(normal_path) ? normal_path : "");
+    atlas_sprites.emplace_back(sprite, tileset);
+  }
+
+  // The individual textures are kept around for the editor, which draws whole
+  // sprite sheets; everything else draws from the atlas where possible.
+  _atlas.build(filesystem, cache, gl, "/default_normal.png");
+  for (std::size_t i = 0; i < atlas_sprites.size(); ++i) {
+    const TextureAtlas::region& region = _atlas.get_region(i);
+    if (!region.packed) {
+      continue;
+    }
+    Sprite& sprite = *atlas_sprites[i].first;
+    sprite.atlas_texture = _atlas.get_page(region.page).texture;
+    sprite.atlas_normal = _atlas.get_page(region.page).normal;
+    sprite.atlas_origin = region.origin;
+    if (atlas_sprites[i].second) {
+      atlas_sprites[i].second->set_texture(sprite);
+    }
   }
 
   filesystem.read_file_with_includes(_default_script->contents,
@@ -123,6 +160,7 @@ Databank::Databank(const Filesystem& filesystem, GlUtil& gl,
     filesystem.read_file_with_includes(lua_file->contents, s);
     scripts.insert(s, std::unique_ptr<LuaFile>(lua_file));
   }
+  compile_scripts(cache);
 
   paths.clear();
   filesystem.list_pattern(paths, "/sounds/**.wav");
@@ -224,18 +262,73 @@ void Databank::make_default_map()
   maps.insert("/world/default.map", std::unique_ptr<CellMap>(map));
 }
 
+void Databank::compile_scripts(Filesystem* cache)
+{
+  typedef std::chrono::steady_clock clock;
+  clock::time_point start = clock::now();
+
+  proto::ScriptCache cached;
+  std::unordered_map<std::string, const proto::ScriptCache::Entry*> entries;
+  if (cache && cache->is_file(script_cache_path)) {
+    std::string data;
+    cache->read_file(data, script_cache_path);
+    if (cached.ParseFromString(data) && cached.version() == LUAJIT_VERSION) {
+      for (const proto::ScriptCache::Entry& entry : cached.entries()) {
+        entries.emplace(entry.path(), &entry);
+      }
+    }
+  }
+
+  proto::ScriptCache output;
+  output.set_version(LUAJIT_VERSION);
+  std::size_t from_cache = 0;
+  auto compile = [&](LuaFile& file)
+  {
+    std::uint64_t hash = std::hash<std::string>()(file.contents);
+    auto it = entries.find(file.path);
+    if (it != entries.end() && it->second->hash() == hash) {
+      file.bytecode = it->second->bytecode();
+      ++from_cache;
+    }
+    else {
+      compile_script(file.bytecode, file.path, file.contents);
+    }
+    proto::ScriptCache::Entry* entry = output.add_entries();
+    entry->set_path(file.path);
+    entry->set_hash(hash);
+    entry->set_bytecode(file.bytecode);
+  };
+  compile(*_default_script);
+  for (std::size_t i = 0; i < scripts.size(); ++i) {
+    compile(scripts.get(i));
+  }
+
+  std::size_t total = 1 + scripts.size();
+  if (cache && from_cache != total) {
+    std::string data;
+    output.SerializeToString(&data);
+    if (!cache->write_file(data, script_cache_path)) {
+      log_err("Couldn't write script cache");
+    }
+  }
+  log_info("Compiled ", total, " scripts (", from_cache, " from cache) in ",
+           std::chrono::duration_cast<std::chrono::microseconds>(
+               clock::now() - start).count(), " us");
+}
+
 void Databank::make_lua_file(LuaFile& file, GameStage& fake_stage)
 {
-  Script script(fake_stage, file.path, file.contents, y::wvec2(), y::wvec2());
+  Script script(fake_stage.get_lua(),
+                file.path, file.get_chunk(), y::wvec2(), y::wvec2());
 
   file.yedit_colour = y::fvec4{.5f, .5f, .5f, 1.f};
   if (script.has_function("yedit_colour")) {
     Script::lua_args out;
     script.call(out, "yedit_colour");
     if (out.size() >= 3) {
-      file.yedit_colour[rr] = float(out[0].world);
-      file.yedit_colour[gg] = float(out[1].world);
-      file.yedit_colour[bb] = float(out[2].world);
+      file.yedit_colour[rr] = float(out[0].world());
+      file.yedit_colour[gg] = float(out[1].world());
+      file.yedit_colour[bb] = float(out[2].world());
     }
   }
 }
@@ -1,6 +1,7 @@
 #ifndef DATA_BANK_H
 #define DATA_BANK_H
 
+#include "atlas.h"
 #include "../render/gl_handle.h"
 #include "../log.h"
 #include "../save.h"
@@ -79,9 +80,14 @@ private:
 struct LuaFile {
   std::string path;
   std::string contents;
+  // Compiled from the contents at load time. Empty if compilation failed.
+  std::string bytecode;
 
   // Editor display.
   y::fvec4 yedit_colour;
+
+  // What Scripts should load: the bytecode if there is any, else the source.
+  const std::string& get_chunk() const;
 };
 
 #ifndef SPRITE_DEC
@@ -89,6 +95,12 @@ struct LuaFile {
 struct Sprite {
   GlTexture2D texture;
   GlTexture2D normal;
+
+  // Where the sprite was packed into the texture atlas, if it was. Otherwise,
+  // the atlas textures are null.
+  GlTexture2D atlas_texture;
+  GlTexture2D atlas_normal;
+  y::ivec2 atlas_origin;
 };
 #endif
 
@@ -97,8 +109,10 @@ public:
 
   ~Databank();
   Databank();
+  // If cache is given, the packed texture atlas and the compiled scripts are
+  // cached there.
   Databank(const Filesystem& filesystem, GlUtil& gl,
-           bool load_yedit_data = false);
+           bool load_yedit_data = false, Filesystem* cache = nullptr);
 
   Databank(const Databank&) = delete;
   Databank& operator=(const Databank&) = delete;
@@ -123,11 +137,16 @@ public:
 private:
 
   void make_default_map();
+  // Compile all the scripts to bytecode, reusing what's in the cache if it's
+  // still valid.
+  void compile_scripts(Filesystem* cache);
   // Load the script and call some functions to get its info.
   void make_lua_file(LuaFile& file, GameStage& gl);
 
   // Used to delete the textures when the Databank is destroyed.
   std::vector<GlUnique<GlTexture2D>> _textures;
+  // Sprites and tilesets packed together, so they can be batched.
+  TextureAtlas _atlas;
 
   std::unique_ptr<LuaFile> _default_script;
   std::unique_ptr<Sprite> _default_sprite;
@@ -282,6 +282,7 @@ const Tile& Cell::get_tile(std::int32_t layer, const y::ivec2& v) const
 
 void Cell::set_tile(std::int32_t layer, const y::ivec2& v, const Tile& tile)
 {
+  _render_cache.reset();
   change_by_one(_changed_tilesets, tile.tileset, true);
 
   std::size_t internal_index = to_internal_index(layer, v);
@@ -312,6 +313,16 @@ bool Cell::is_tileset_used(const Tileset& tileset) const
   return change_diff + _blueprint.get_tileset_use_count(tileset) > 0;
 }
 
+Cell::render_cache* Cell::get_render_cache() const
+{
+  return _render_cache.get();
+}
+
+void Cell::set_render_cache(std::unique_ptr<render_cache> cache) const
+{
+  _render_cache = std::move(cache);
+}
+
 CellBlueprint::CellBlueprint()
   : _tiles(new Tile[raw_size])
 {
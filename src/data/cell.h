@@ -121,9 +121,18 @@ public:
   // Returns true iff the tileset is currently used for any tile.
   bool is_tileset_used(const Tileset& tileset) const;
 
+  // Opaque data the renderer can derive from the tiles and keep around between
+  // frames. Thrown away whenever a tile changes.
+  struct render_cache {
+    virtual ~render_cache() {}
+  };
+  render_cache* get_render_cache() const;
+  void set_render_cache(std::unique_ptr<render_cache> cache) const;
+
 private:
 
   const CellBlueprint& _blueprint;
+  mutable std::unique_ptr<render_cache> _render_cache;
 
   std::unordered_map<const Tileset*, std::int32_t> _changed_tilesets;
   std::unordered_map<std::size_t, Tile> _changed_tiles;
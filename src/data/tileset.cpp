@@ -28,6 +28,11 @@ const Sprite& Tileset::get_texture() const
   return _texture;
 }
 
+void Tileset::set_texture(const Sprite& texture)
+{
+  _texture = texture;
+}
+
 const y::ivec2& Tileset::get_size() const
 {
   return _size;
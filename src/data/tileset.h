@@ -11,6 +11,12 @@
 struct Sprite {
   GlTexture2D texture;
   GlTexture2D normal;
+
+  // Where the sprite was packed into the texture atlas, if it was. Otherwise,
+  // the atlas textures are null.
+  GlTexture2D atlas_texture;
+  GlTexture2D atlas_normal;
+  y::ivec2 atlas_origin;
 };
 #endif
 namespace proto {
@@ -64,6 +70,9 @@ public:
 
   Tileset(const Sprite& texture);
   const Sprite& get_texture() const;
+  // Replace the texture with one of the same size (e.g. when it's been packed
+  // into an atlas).
+  void set_texture(const Sprite& texture);
 
   const y::ivec2& get_size() const;
   std::size_t get_tile_count() const;
@@ -271,7 +271,7 @@ std::int32_t main(std::int32_t, char**)
   if (!gl) {
     return 1;
   }
-  Databank databank(filesystem, gl, true);
+  Databank databank(filesystem, gl, true, &filesystem);
   RenderUtil util(gl);
 
   ModalStack stack;
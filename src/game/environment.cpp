@@ -457,7 +457,7 @@ void Environment::render_physics(const GameRenderer& renderer) const
     renderer.set_current_draw_any();
     if (sprite) {
       renderer.get_current_batch().add_sprite(
-          sprite->texture, frame_size, false,
+          RenderBatch::sprite_sheet(*sprite, false), frame_size, false,
           y::fvec2(pos - y::wvec2(frame_size / 2)),
           frame, depth, 0.f, colour);
       return;
@@ -533,7 +533,7 @@ void Environment::render_physics_normal(const GameRenderer& renderer) const
     renderer.set_current_draw_any();
     if (sprite) {
       renderer.get_current_batch().add_sprite(
-          sprite->normal, frame_size, true,
+          RenderBatch::sprite_sheet(*sprite, true), frame_size, true,
           y::fvec2(pos - y::wvec2(frame_size / 2)),
           frame, depth, 0.f, y::fvec4{1.f, 1.f, 1.f, 1.f});
       return;
@@ -587,6 +587,20 @@ void Environment::render_physics_normal(const GameRenderer& renderer) const
       GL_TRIANGLES, 6 * i);
 }
 
+void Environment::get_physics_layers(std::vector<bool>& layers) const
+{
+  for (const Particle& p : _particles) {
+    if (p.layer >= 0 && std::size_t(p.layer) < layers.size()) {
+      layers[p.layer] = true;
+    }
+  }
+  for (const Rope& rope : _ropes) {
+    if (rope._layer >= 0 && std::size_t(rope._layer) < layers.size()) {
+      layers[rope._layer] = true;
+    }
+  }
+}
+
 void Environment::render_fog_colour(
     RenderUtil& util, const y::wvec2& origin, const y::wvec2& region,
     const fog_params& params) const
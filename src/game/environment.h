@@ -203,6 +203,8 @@ public:
   void update_physics();
   void render_physics(const GameRenderer& renderer) const;
   void render_physics_normal(const GameRenderer& renderer) const;
+  // Flags each draw layer that has any particles or ropes on it.
+  void get_physics_layers(std::vector<bool>& layers) const;
 
   // Complicated environment shaders below here.
   void render_fog_colour(
@@ -5,6 +5,20 @@
 #include "../render/util.h"
 
 #include <boost/functional/hash.hpp>
+#include <chrono>
+
+namespace {
+
+  typedef std::chrono::high_resolution_clock hrclock;
+
+  std::size_t elapsed_ns(const hrclock::time_point& start,
+                         const hrclock::time_point& end)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        end - start).count();
+  }
+
+}
 
 Light::Light(const Script& source)
   : source(source)
@@ -14,6 +28,7 @@ Light::Light(const Script& source)
   , colour{1.f, 1.f, 1.f, 1.f}
   , angle(0.)
   , aperture(y::pi)
+  , is_static(false)
 {
 }
 
@@ -63,6 +78,17 @@ bool Light::overlaps_rect(const y::wvec2& origin,
   return light_max > min && light_min < max;
 }
 
+Lighting::trace_stats::trace_stats()
+  : lights(0)
+  , traced(0)
+  , trace_vertices(0)
+  , ns_query(0)
+  , ns_sort(0)
+  , ns_sweep(0)
+  , ns_cone(0)
+{
+}
+
 Lighting::Lighting(const WorldWindow& world, GlUtil& gl)
   : _world(world)
   , _gl(gl)
@@ -72,18 +98,10 @@ Lighting::Lighting(const WorldWindow& world, GlUtil& gl)
   , _light_specular_program(gl.make_unique_program({
         "/shaders/light/light_specular.v.glsl",
         "/shaders/light/light_specular.f.glsl"}))
-  , _tri(gl.make_unique_buffer<GLfloat, 2>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _origin(gl.make_unique_buffer<GLfloat, 2>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _range(gl.make_unique_buffer<GLfloat, 2>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _colour(gl.make_unique_buffer<GLfloat, 4>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _layering(gl.make_unique_buffer<GLfloat, 1>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _element_buffer(gl.make_unique_buffer<GLushort, 1>(
-        GL_ELEMENT_ARRAY_BUFFER, GL_STREAM_DRAW))
+  , _static_mesh(gl, GL_STATIC_DRAW)
+  , _static_mesh_dirty(true)
+  , _dynamic_mesh(gl, GL_DYNAMIC_DRAW)
+  , _dynamic_mesh_dirty(true)
 {
 }
 
@@ -92,10 +110,15 @@ void Lighting::recalculate_traces(
 {
   // Sorts points radially by angle from the origin point using a Graham
   // scan-like algorithm, starting at angle 0 (rightwards) and increasing
-  // by angle.
+  // by angle. Points are given by index into the vertex list.
   struct angular_order {
-    bool operator()(const y::wvec2& a, const y::wvec2& b) const
+    const std::vector<y::wvec2>* vertices;
+
+    bool operator()(std::size_t a_index, std::size_t b_index) const
     {
+      const y::wvec2& a = (*vertices)[a_index];
+      const y::wvec2& b = (*vertices)[b_index];
+
       // Eliminate points in opposite half-planes.
       if (a[yy] >= 0 && b[yy] < 0) {
         return true;
@@ -118,10 +141,14 @@ void Lighting::recalculate_traces(
   // Sorts with respect to a given vector by projecting the two-dimensional
   // plane onto the line formed by the vector and sorting along this line.
   struct planar_order {
+    const std::vector<y::wvec2>* vertices;
     y::wvec2 normal_vec;
 
-    bool operator()(const y::wvec2& a, const y::wvec2& b) const
+    bool operator()(std::size_t a_index, std::size_t b_index) const
     {
+      const y::wvec2& a = (*vertices)[a_index];
+      const y::wvec2& b = (*vertices)[b_index];
+
       y::wvec2 plane_vec{normal_vec[yy], -normal_vec[xx]};
       y::world a_dot = a.dot(plane_vec);
       y::world b_dot = b.dot(plane_vec);
@@ -147,11 +174,10 @@ void Lighting::recalculate_traces(
   // Only bother with this if performance actually becomes an issue.
   std::unordered_set<trace_key, trace_key_hash> trace_preserve;
 
-  std::vector<y::wvec2> vertex_buffer;
-  geometry_entry geometry_buffer;
-  geometry_map map;
-  angular_order angular;
-  planar_order planar;
+  angular_order angular{&_graph.vertices};
+  planar_order planar{&_graph.vertices, y::wvec2()};
+
+  _stats = trace_stats();
 
   source_list sources;
   get_sources(sources);
@@ -159,37 +185,40 @@ void Lighting::recalculate_traces(
     for (const entry& light : get_list(*s)) {
       const y::wvec2 origin = light->get_origin(s->get_origin());
 
-      // Skip if light doesn't overlap camera.
-      if (!light->overlaps_rect(origin, camera_min, camera_max)) {
+      // Skip if light doesn't overlap camera. Static lights are traced
+      // regardless, since their mesh isn't limited to the camera.
+      if (!light->is_static &&
+          !light->overlaps_rect(origin, camera_min, camera_max)) {
         continue;
       }
 
       trace_key key{origin, light->get_max_range(),
                     light->normal_vec, light->get_offset()};
       trace_preserve.insert(key);
+      ++_stats.lights;
 
       // If the result is cached, we don't need to recalculate it.
       if (_trace_results.find(key) != _trace_results.end()) {
         continue;
       }
-      vertex_buffer.clear();
-      geometry_buffer.clear();
-      map.clear();
+      ++_stats.traced;
 
       // Find all the geometries that intersect the max-range square and their
       // vertices, translated respective to origin.
-      get_relevant_geometry(vertex_buffer, geometry_buffer, map,
-                            *light, origin, _world.get_geometry(),
+      hrclock::time_point query_start = hrclock::now();
+      get_relevant_geometry(_graph, *light, origin, _world.get_geometry(),
                             light->is_planar());
+      hrclock::time_point sort_start = hrclock::now();
 
       // Perform the appropriate vertex sort.
       if (light->is_planar()) {
         planar.normal_vec = light->normal_vec;
-        std::sort(vertex_buffer.begin(), vertex_buffer.end(), planar);
+        std::sort(_graph.order.begin(), _graph.order.end(), planar);
       }
       else {
-        std::sort(vertex_buffer.begin(), vertex_buffer.end(), angular);
+        std::sort(_graph.order.begin(), _graph.order.end(), angular);
       }
+      hrclock::time_point sweep_start = hrclock::now();
 
       // Trace the light geometry.
       // TODO: soften the shadows, somehow. I think the best approach is, for
@@ -197,9 +226,13 @@ void Lighting::recalculate_traces(
       // add another set of triangles from these. However if the new triangle
       // intersects geometry, we need to split it up (and split up the existing
       // line from the corner).
-      trace_light_geometry(_trace_results[key], *light,
-                           vertex_buffer, geometry_buffer, map,
+      trace_light_geometry(_trace_results[key], *light, _graph, _stack,
                            light->is_planar());
+      hrclock::time_point sweep_end = hrclock::now();
+
+      _stats.ns_query += elapsed_ns(query_start, sort_start);
+      _stats.ns_sort += elapsed_ns(sort_start, sweep_start);
+      _stats.ns_sweep += elapsed_ns(sweep_start, sweep_end);
     }
   }
 
@@ -212,11 +245,27 @@ void Lighting::recalculate_traces(
       it = _trace_results.erase(it);
     }
   }
+  for (const auto& pair : _trace_results) {
+    _stats.trace_vertices += pair.second.size();
+  }
+
+  // Colours and ranges can change without affecting the traces, so rebuild the
+  // dynamic mesh on the next render regardless. _static_mesh is only
+  // rebuilt when an is_static light actually changes.
+  _dynamic_mesh_dirty = true;
+  update_static_mesh();
+}
+
+const Lighting::trace_stats& Lighting::get_trace_stats() const
+{
+  return _stats;
 }
 
 void Lighting::clear_results_and_cache()
 {
   _trace_results.clear();
+  _static_mesh_dirty = true;
+  _dynamic_mesh_dirty = true;
 }
 
 void Lighting::render_traces(
@@ -264,49 +313,6 @@ void Lighting::render_specularbuffer(
   render_internal(util, normalbuffer, camera_min, camera_max, true);
 }
 
-void Lighting::add_vertex(const y::wvec2& origin, const y::wvec2& trace,
-                          const Light& light) const
-{
-  _tri.data.emplace_back(trace[xx]);
-  _tri.data.emplace_back(trace[yy]);
-  _origin.data.emplace_back(origin[xx]);
-  _origin.data.emplace_back(origin[yy]);
-  _range.data.emplace_back(light.full_range);
-  _range.data.emplace_back(light.falloff_range);
-  _layering.data.emplace_back(light.layer_value);
-  _colour.data.emplace_back(light.colour[rr]);
-  _colour.data.emplace_back(light.colour[gg]);
-  _colour.data.emplace_back(light.colour[bb]);
-  _colour.data.emplace_back(light.colour[aa]);
-}
-
-void Lighting::add_triangle(
-    std::vector<GLushort>& element_data, const y::wvec2& min, const y::wvec2& max,
-    std::size_t start_index, std::size_t a, std::size_t b, std::size_t c,
-    const y::wvec2& at, const y::wvec2& bt, const y::wvec2& ct) const
-{
-  static const y::wvec2 o;
-  // Check has area.
-  if (a == b || a == c || a == b) {
-    return;
-  }
-  // Check overlaps camera. The line-rect tests cover the case where the
-  // triangle is inside or intersects the rectangle. To cover the case where the
-  // rectangle is inside the triangle we check one vertex of the rectangle.
-  bool ab_test = (bt - at).cross(min - at) < 0;
-  bool bc_test = (ct - bt).cross(min - bt) < 0;
-  bool ca_test = (at - ct).cross(min - ct) < 0;
-  if (!y::line_intersects_rect(at, bt, min, max) &&
-      !y::line_intersects_rect(at, ct, min, max) &&
-      !y::line_intersects_rect(bt, ct, min, max) &&
-      !(ab_test == bc_test && bc_test == ca_test)) {
-    return;
-  }
-  element_data.emplace_back(start_index + a);
-  element_data.emplace_back(start_index + b);
-  element_data.emplace_back(start_index + c);
-}
-
 void Lighting::render_internal(
     RenderUtil& util, const GlFramebuffer& normalbuffer,
     const y::wvec2& camera_min, const y::wvec2& camera_max,
@@ -315,42 +321,11 @@ void Lighting::render_internal(
   if (!(util.get_resolution() >= y::ivec2())) {
     return;
   }
-  _tri.data.clear();
-  _origin.data.clear();
-  _range.data.clear();
-  _layering.data.clear();
-  _colour.data.clear();
-  _element_data.clear();
-
-  source_list sources;
-  get_sources(sources);
-  for (const Script* s : sources) {
-    for (const entry& light : get_list(*s)) {
-      const y::wvec2 origin = light->get_origin(s->get_origin());
-
-      trace_key key{origin, light->get_max_range(),
-                    light->normal_vec, light->get_offset()};
-      auto it = _trace_results.find(key);
-      if (it == _trace_results.end() || !it->second.size()) {
-        continue;
-      }
-
-      // If the light is conical, slice out the correct section.
-      light_trace cone_trace;
-      bool cone_light = !light->is_planar() && light->aperture < y::pi;
-      const light_trace& trace = cone_light ? cone_trace : it->second;
-      if (cone_light) {
-        make_cone_trace(cone_trace, it->second, light->angle, light->aperture);
-      }
-
-      // Set up the vertex data and indices.
-      if (light->is_planar()) {
-        render_planar_internal(trace, *light, origin, camera_min, camera_max);
-      }
-      else {
-        render_angular_internal(trace, *light, origin, camera_min, camera_max);
-      }
-    }
+  update_dynamic_mesh(camera_min, camera_max);
+  std::size_t total =
+      _static_mesh.ranges.size() + _dynamic_mesh.ranges.size();
+  if (!total) {
+    return;
   }
 
   util.get_gl().enable_depth(true, GL_LESS);
@@ -360,11 +335,6 @@ void Lighting::render_internal(
 
   program.bind();
   program.bind_uniform("normalbuffer", normalbuffer);
-  program.bind_attribute("pixels", _tri.reupload());
-  program.bind_attribute("origin", _origin.reupload());
-  program.bind_attribute("range", _range.reupload());
-  program.bind_attribute("layer", _layering.reupload());
-  program.bind_attribute("colour", _colour.reupload());
   util.bind_pixel_uniforms(program);
 
   // It really shouldn't be necessary to use depth and draw lights one by one.
@@ -372,34 +342,144 @@ void Lighting::render_internal(
   // stop the light triangles from very occassionally overlapping and producing
   // artefacts, even though the triangles are formed with *exactly* the same
   // edges. I don't know what's going wrong.
-  std::size_t n = _element_data.size();
-  for (const auto& data : _element_data) {
-    program.bind_uniform("depth", float(n--) / (1 + _element_data.size()));
-    _element_buffer->reupload_data(data);
-    _element_buffer->draw_elements(GL_TRIANGLES, data.size());
+  std::size_t n = total;
+  draw_mesh(program, _static_mesh, n, total);
+  draw_mesh(program, _dynamic_mesh, n, total);
+}
+
+void Lighting::update_static_mesh()
+{
+  _static_keys_next.clear();
+  source_list sources;
+  get_sources(sources);
+  for (const Script* s : sources) {
+    for (const entry& light : get_list(*s)) {
+      if (light->is_static) {
+        _static_keys_next.emplace_back(
+            *light, light->get_origin(s->get_origin()));
+      }
+    }
+  }
+  if (!_static_mesh_dirty && _static_keys_next == _static_keys) {
+    return;
+  }
+  _static_mesh_dirty = false;
+  std::swap(_static_keys, _static_keys_next);
+
+  // Static meshes aren't culled to the camera, so that they stay valid as it
+  // moves around.
+  _static_mesh.clear();
+  for (const Script* s : sources) {
+    for (const entry& light : get_list(*s)) {
+      if (light->is_static) {
+        add_light_to_mesh(_static_mesh, *light, *s,
+                          y::wvec2(), y::wvec2(), false);
+      }
+    }
   }
+  _static_mesh.reupload();
 }
 
-void Lighting::render_angular_internal(
-    const light_trace& trace, const Light& light, const y::wvec2& origin,
+void Lighting::update_dynamic_mesh(
     const y::wvec2& camera_min, const y::wvec2& camera_max) const
+{
+  if (!_dynamic_mesh_dirty &&
+      camera_min == _mesh_camera_min && camera_max == _mesh_camera_max) {
+    return;
+  }
+  _dynamic_mesh_dirty = false;
+  _mesh_camera_min = camera_min;
+  _mesh_camera_max = camera_max;
+
+  _dynamic_mesh.clear();
+  source_list sources;
+  get_sources(sources);
+  for (const Script* s : sources) {
+    for (const entry& light : get_list(*s)) {
+      if (!light->is_static) {
+        add_light_to_mesh(_dynamic_mesh, *light, *s,
+                          camera_min, camera_max, true);
+      }
+    }
+  }
+  _dynamic_mesh.reupload();
+}
+
+void Lighting::add_light_to_mesh(
+    light_mesh& mesh, const Light& light, const Script& source,
+    const y::wvec2& camera_min, const y::wvec2& camera_max, bool cull) const
+{
+  const y::wvec2 origin = light.get_origin(source.get_origin());
+
+  trace_key key{origin, light.get_max_range(),
+                light.normal_vec, light.get_offset()};
+  auto it = _trace_results.find(key);
+  if (it == _trace_results.end() || !it->second.size()) {
+    return;
+  }
+
+  // If the light is conical, slice out the correct section.
+  light_trace cone_trace;
+  bool cone_light = !light.is_planar() && light.aperture < y::pi;
+  const light_trace& trace = cone_light ? cone_trace : it->second;
+  if (cone_light) {
+    hrclock::time_point cone_start = hrclock::now();
+    make_cone_trace(cone_trace, it->second, light.angle, light.aperture);
+    _stats.ns_cone += elapsed_ns(cone_start, hrclock::now());
+  }
+
+  // Set up the vertex data and indices.
+  const y::wvec2 min = camera_min - origin;
+  const y::wvec2 max = camera_max - origin;
+  std::size_t offset = mesh.element.data.size();
+  if (light.is_planar()) {
+    add_planar_light(mesh, trace, light, origin, min, max, cull);
+  }
+  else {
+    add_angular_light(mesh, trace, light, origin, min, max, cull);
+  }
+  if (mesh.element.data.size() > offset) {
+    mesh.ranges.push_back(
+        element_range{offset, mesh.element.data.size() - offset});
+  }
+}
+
+void Lighting::draw_mesh(const GlProgram& program, const light_mesh& mesh,
+                         std::size_t& n, std::size_t total)
+{
+  if (mesh.ranges.empty()) {
+    return;
+  }
+  program.bind_attribute("pixels", *mesh.tri.buffer);
+  program.bind_attribute("origin", *mesh.origin.buffer);
+  program.bind_attribute("range", *mesh.range.buffer);
+  program.bind_attribute("layer", *mesh.layering.buffer);
+  program.bind_attribute("colour", *mesh.colour.buffer);
+
+  for (const element_range& range : mesh.ranges) {
+    program.bind_uniform("depth", float(n--) / (1 + total));
+    mesh.element.buffer->draw_elements(
+        GL_TRIANGLES, range.count, range.offset);
+  }
+}
+
+void Lighting::add_angular_light(
+    light_mesh& mesh, const light_trace& trace,
+    const Light& light, const y::wvec2& origin,
+    const y::wvec2& min, const y::wvec2& max, bool cull)
 {
   // Arranging in a triangle fan causes tears in the triangles due to slight
   // inaccuracies, so we use a fan with three triangles per actual triangle
   // to make sure the edges line up exactly.
-  std::size_t origin_index = _tri.data.size() / 2;
+  std::size_t origin_index = mesh.tri.data.size() / 2;
 
   // Set up the vertices.
-  add_vertex(origin, origin, light);
+  mesh.add_vertex(origin, origin, light);
   for (std::size_t i = 0; i < trace.size(); ++i) {
-    add_vertex(origin, origin + trace[i], light);
+    mesh.add_vertex(origin, origin + trace[i], light);
   }
-  const y::wvec2 min = camera_min - origin;
-  const y::wvec2 max = camera_max - origin;
 
   // Set up the indices.
-  _element_data.emplace_back();
-  auto& light_element_data = *_element_data.rbegin();
   for (std::size_t i = 1; i < trace.size(); i += 2) {
     std::size_t prev = i - 1;
     std::size_t a = i;
@@ -417,41 +497,37 @@ void Lighting::render_angular_internal(
     // origin, l, r; l, r, b; a, b, l.
     // Triangles which have no area or do not overlap the camera are
     // skipped in the add_triangle function.
-    add_triangle(light_element_data, min, max, origin_index,
-                 0, 1 + l, 1 + r,
-                 y::wvec2(), trace[l], trace[r]);
-    add_triangle(light_element_data, min, max, origin_index,
-                 1 + l, 1 + r, 1 + b,
-                 trace[l], trace[r], trace[b]);
-    add_triangle(light_element_data, min, max, origin_index,
-                 1 + a, 1 + b, 1 + l,
-                 trace[a], trace[b], trace[l]);
+    mesh.add_triangle(min, max, cull, origin_index,
+                      0, 1 + l, 1 + r,
+                      y::wvec2(), trace[l], trace[r]);
+    mesh.add_triangle(min, max, cull, origin_index,
+                      1 + l, 1 + r, 1 + b,
+                      trace[l], trace[r], trace[b]);
+    mesh.add_triangle(min, max, cull, origin_index,
+                      1 + a, 1 + b, 1 + l,
+                      trace[a], trace[b], trace[l]);
   }
 }
 
-void Lighting::render_planar_internal(
-    const light_trace& trace, const Light& light, const y::wvec2& origin,
-    const y::wvec2& camera_min, const y::wvec2& camera_max) const
+void Lighting::add_planar_light(
+    light_mesh& mesh, const light_trace& trace,
+    const Light& light, const y::wvec2& origin,
+    const y::wvec2& min, const y::wvec2& max, bool cull)
 {
   // Similarly here we use up to 4 triangles to prevent tearing.
-  std::size_t start_index = _tri.data.size() / 2;
+  std::size_t start_index = mesh.tri.data.size() / 2;
 
   // Set up the vertices.
   y::wvec2 offset = light.get_offset();
   for (std::size_t i = 0; i < trace.size(); i += 2) {
     y::wvec2 on_plane = get_planar_point_on_geometry(
         light.normal_vec, trace[i], world_geometry(-offset, offset));
-    add_vertex(origin + on_plane, origin + on_plane, light);
-    add_vertex(origin + on_plane, origin + trace[i], light);
-    add_vertex(origin + on_plane, origin + trace[1 + i], light);
+    mesh.add_vertex(origin + on_plane, origin + on_plane, light);
+    mesh.add_vertex(origin + on_plane, origin + trace[i], light);
+    mesh.add_vertex(origin + on_plane, origin + trace[1 + i], light);
   }
 
-  const y::wvec2 min = camera_min - origin;
-  const y::wvec2 max = camera_max - origin;
-
   // Set up the indices.
-  _element_data.emplace_back();
-  auto& light_element_data = *_element_data.rbegin();
   for (std::size_t i = 1; i < trace.size() - 2; i += 2) {
     std::size_t prev = i - 1;
     std::size_t a = i;
@@ -470,26 +546,26 @@ void Lighting::render_planar_internal(
 
     // Render the triangles, using the configuration:
     // left on-plane, right on-plane, r; left on-plane, l, r; l, r, a; a, b, r.
-    add_triangle(light_element_data, min, max, start_index,
-                 3 * (l / 2),
-                 3 * (r / 2),
-                 1 + 3 * (r / 2) + (r % 2),
-                 on_plane_l, on_plane_r, trace[r]);
-    add_triangle(light_element_data, min, max, start_index,
-                 3 * (l / 2),
-                 1 + 3 * (l / 2) + (l % 2),
-                 1 + 3 * (r / 2) + (r % 2),
-                 on_plane_l, trace[l], trace[r]);
-    add_triangle(light_element_data, min, max, start_index,
-                 1 + 3 * (l / 2) + (l % 2),
-                 1 + 3 * (r / 2) + (r % 2),
-                 1 + 3 * (a / 2) + (a % 2),
-                 trace[l], trace[r], trace[a]);
-    add_triangle(light_element_data, min, max, start_index,
-                 1 + 3 * (a / 2) + (a % 2),
-                 1 + 3 * (b / 2) + (b % 2),
-                 1 + 3 * (r / 2) + (r % 2),
-                 trace[a], trace[b], trace[r]);
+    mesh.add_triangle(min, max, cull, start_index,
+                      3 * (l / 2),
+                      3 * (r / 2),
+                      1 + 3 * (r / 2) + (r % 2),
+                      on_plane_l, on_plane_r, trace[r]);
+    mesh.add_triangle(min, max, cull, start_index,
+                      3 * (l / 2),
+                      1 + 3 * (l / 2) + (l % 2),
+                      1 + 3 * (r / 2) + (r % 2),
+                      on_plane_l, trace[l], trace[r]);
+    mesh.add_triangle(min, max, cull, start_index,
+                      1 + 3 * (l / 2) + (l % 2),
+                      1 + 3 * (r / 2) + (r % 2),
+                      1 + 3 * (a / 2) + (a % 2),
+                      trace[l], trace[r], trace[a]);
+    mesh.add_triangle(min, max, cull, start_index,
+                      1 + 3 * (a / 2) + (a % 2),
+                      1 + 3 * (b / 2) + (b % 2),
+                      1 + 3 * (r / 2) + (r % 2),
+                      trace[a], trace[b], trace[r]);
   }
 }
 
@@ -549,34 +625,218 @@ bool Lighting::world_geometry::operator!=(const world_geometry& g) const
   return !operator==(g);
 }
 
-std::size_t Lighting::world_geometry_hash::operator()(const world_geometry& g) const
+Lighting::light_key::light_key(const Light& light,
+                               const y::wvec2& origin)
+  : origin(origin)
+  , offset(light.offset)
+  , full_range(light.full_range)
+  , falloff_range(light.falloff_range)
+  , layer_value(light.layer_value)
+  , colour(light.colour)
+  , angle(light.angle)
+  , aperture(light.aperture)
+  , normal_vec(light.normal_vec)
+{
+}
+
+bool Lighting::light_key::operator==(const light_key& key) const
+{
+  return origin == key.origin && offset == key.offset &&
+      full_range == key.full_range && falloff_range == key.falloff_range &&
+      layer_value == key.layer_value && colour == key.colour &&
+      angle == key.angle && aperture == key.aperture &&
+      normal_vec == key.normal_vec;
+}
+
+bool Lighting::light_key::operator!=(const light_key& key) const
+{
+  return !operator==(key);
+}
+
+Lighting::light_mesh::light_mesh(GlUtil& gl, GLenum usage_hint)
+  : tri(gl.make_unique_buffer<GLfloat, 2>(GL_ARRAY_BUFFER, usage_hint))
+  , origin(gl.make_unique_buffer<GLfloat, 2>(GL_ARRAY_BUFFER, usage_hint))
+  , range(gl.make_unique_buffer<GLfloat, 2>(GL_ARRAY_BUFFER, usage_hint))
+  , colour(gl.make_unique_buffer<GLfloat, 4>(GL_ARRAY_BUFFER, usage_hint))
+  , layering(gl.make_unique_buffer<GLfloat, 1>(GL_ARRAY_BUFFER, usage_hint))
+  , element(gl.make_unique_buffer<GLuint, 1>(
+        GL_ELEMENT_ARRAY_BUFFER, usage_hint))
 {
-  std::size_t seed = 0;
-  boost::hash_combine(seed, g.start[xx]);
-  boost::hash_combine(seed, g.start[yy]);
-  boost::hash_combine(seed, g.end[xx]);
-  boost::hash_combine(seed, g.end[yy]);
-  return seed;
+}
+
+void Lighting::light_mesh::clear()
+{
+  tri.data.clear();
+  origin.data.clear();
+  range.data.clear();
+  colour.data.clear();
+  layering.data.clear();
+  element.data.clear();
+  ranges.clear();
+}
+
+void Lighting::light_mesh::reupload() const
+{
+  tri.reupload();
+  origin.reupload();
+  range.reupload();
+  colour.reupload();
+  layering.reupload();
+  element.reupload();
+}
+
+void Lighting::light_mesh::add_vertex(
+    const y::wvec2& light_origin, const y::wvec2& trace, const Light& light)
+{
+  tri.data.emplace_back(trace[xx]);
+  tri.data.emplace_back(trace[yy]);
+  origin.data.emplace_back(light_origin[xx]);
+  origin.data.emplace_back(light_origin[yy]);
+  range.data.emplace_back(light.full_range);
+  range.data.emplace_back(light.falloff_range);
+  layering.data.emplace_back(light.layer_value);
+  colour.data.emplace_back(light.colour[rr]);
+  colour.data.emplace_back(light.colour[gg]);
+  colour.data.emplace_back(light.colour[bb]);
+  colour.data.emplace_back(light.colour[aa]);
+}
+
+void Lighting::light_mesh::add_triangle(
+    const y::wvec2& min, const y::wvec2& max, bool cull,
+    std::size_t start_index, std::size_t a, std::size_t b, std::size_t c,
+    const y::wvec2& at, const y::wvec2& bt, const y::wvec2& ct)
+{
+  // Check has area.
+  if (a == b || a == c || a == b) {
+    return;
+  }
+  // Check overlaps camera. The line-rect tests cover the case where the
+  // triangle is inside or intersects the rectangle. To cover the case where the
+  // rectangle is inside the triangle we check one vertex of the rectangle.
+  bool ab_test = (bt - at).cross(min - at) < 0;
+  bool bc_test = (ct - bt).cross(min - bt) < 0;
+  bool ca_test = (at - ct).cross(min - ct) < 0;
+  if (cull &&
+      !y::line_intersects_rect(at, bt, min, max) &&
+      !y::line_intersects_rect(at, ct, min, max) &&
+      !y::line_intersects_rect(bt, ct, min, max) &&
+      !(ab_test == bc_test && bc_test == ca_test)) {
+    return;
+  }
+  element.data.emplace_back(start_index + a);
+  element.data.emplace_back(start_index + b);
+  element.data.emplace_back(start_index + c);
+}
+
+void Lighting::geometry_graph::clear()
+{
+  vertices.clear();
+  segments.clear();
+  adjacency_start.clear();
+  adjacency.clear();
+  order.clear();
+  endpoints.clear();
+}
+
+void Lighting::geometry_graph::add_segment(const y::wvec2& start,
+                                           const y::wvec2& end)
+{
+  endpoints.push_back({start, segments.size(), true});
+  endpoints.push_back({end, segments.size(), false});
+  segments.push_back({0, 0});
+}
+
+void Lighting::geometry_graph::build()
+{
+  // Sorting the endpoints brings together those at the same vertex, which
+  // gives us the deduplicated vertex list and the adjacency lists in one go.
+  // The vertices are exact copies of the same integer coordinates, so the
+  // comparison is safe.
+  auto endpoint_order = [](const endpoint& a, const endpoint& b)
+  {
+    return a.v[xx] < b.v[xx] || (a.v[xx] == b.v[xx] && a.v[yy] < b.v[yy]);
+  };
+  std::sort(endpoints.begin(), endpoints.end(), endpoint_order);
+
+  for (std::size_t i = 0; i < endpoints.size(); ++i) {
+    const endpoint& e = endpoints[i];
+    if (!i || e.v != endpoints[i - 1].v) {
+      adjacency_start.emplace_back(adjacency.size());
+      vertices.emplace_back(e.v);
+    }
+    std::size_t index = vertices.size() - 1;
+    (e.start ? segments[e.segment].start : segments[e.segment].end) = index;
+    adjacency.emplace_back(e.segment);
+  }
+  adjacency_start.emplace_back(adjacency.size());
+
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    order.emplace_back(i);
+  }
+}
+
+void Lighting::geometry_graph::add_vertex(const y::wvec2& v)
+{
+  order.emplace_back(vertices.size());
+  vertices.emplace_back(v);
+  adjacency_start.emplace_back(adjacency.size());
+}
+
+Lighting::world_geometry Lighting::geometry_graph::get_geometry(
+    std::size_t segment) const
+{
+  const geometry_graph::segment& s = segments[segment];
+  return world_geometry(vertices[s.start], vertices[s.end]);
+}
+
+void Lighting::geometry_stack::reset(std::size_t size)
+{
+  segments.clear();
+  positions.assign(size, std::size_t(-1));
+}
+
+void Lighting::geometry_stack::insert(std::size_t segment)
+{
+  if (positions[segment] != std::size_t(-1)) {
+    return;
+  }
+  positions[segment] = segments.size();
+  segments.emplace_back(segment);
+}
+
+void Lighting::geometry_stack::erase(std::size_t segment)
+{
+  std::size_t position = positions[segment];
+  if (position == std::size_t(-1)) {
+    return;
+  }
+  // Swap with the last element so removal doesn't need to shift anything.
+  positions[segments.back()] = position;
+  segments[position] = segments.back();
+  segments.pop_back();
+  positions[segment] = std::size_t(-1);
+}
+
+bool Lighting::geometry_stack::empty() const
+{
+  return segments.empty();
 }
 
 void Lighting::get_relevant_geometry(
-    std::vector<y::wvec2>& vertex_output, geometry_entry& geometry_output,
-    geometry_map& map_output, const Light& light, const y::wvec2& origin,
+    geometry_graph& output, const Light& light, const y::wvec2& origin,
     const WorldGeometry::geometry_hash& all_geometry, bool planar)
 {
+  output.clear();
   if (planar) {
-    get_planar_relevant_geometry(vertex_output, geometry_output, map_output,
-                                 light, origin, all_geometry);
+    get_planar_relevant_geometry(output, light, origin, all_geometry);
   }
   else {
-    get_angular_relevant_geometry(vertex_output, geometry_output, map_output,
-                                  light, origin, all_geometry);
+    get_angular_relevant_geometry(output, light, origin, all_geometry);
   }
 }
 
 void Lighting::get_angular_relevant_geometry(
-    std::vector<y::wvec2>& vertex_output, geometry_entry& geometry_output,
-    geometry_map& map_output, const Light& light, const y::wvec2& origin,
+    geometry_graph& output, const Light& light, const y::wvec2& origin,
     const WorldGeometry::geometry_hash& all_geometry)
 {
   // We could find only the vertices whose geometries intersect the circle
@@ -609,27 +869,22 @@ void Lighting::get_angular_relevant_geometry(
       continue;
     }
 
-    geometry_output.emplace_back(g_s, g_e);
-    map_output[g_s].emplace_back(g_s, g_e);
-    map_output[g_e].emplace_back(g_s, g_e);
-  }
-  for (const auto& pair : map_output) {
-    vertex_output.emplace_back(pair.first);
+    output.add_segment(g_s, g_e);
   }
+  output.build();
 
   // Add corners of the max-range square. These aren't real vertices, but cause
   // the trace_light_geometry algorithm to stick to the outside of the square
   // when there is a period of rotation greater than pi / 2 containing no
   // vertices.
-  vertex_output.emplace_back(y::wvec2{-max_range, -max_range});
-  vertex_output.emplace_back(y::wvec2{max_range, -max_range});
-  vertex_output.emplace_back(y::wvec2{-max_range, max_range});
-  vertex_output.emplace_back(y::wvec2{max_range, max_range});
+  output.add_vertex(y::wvec2{-max_range, -max_range});
+  output.add_vertex(y::wvec2{max_range, -max_range});
+  output.add_vertex(y::wvec2{-max_range, max_range});
+  output.add_vertex(y::wvec2{max_range, max_range});
 }
 
 void Lighting::get_planar_relevant_geometry(
-    std::vector<y::wvec2>& vertex_output, geometry_entry& geometry_output,
-    geometry_map& map_output, const Light& light, const y::wvec2& origin,
+    geometry_graph& output, const Light& light, const y::wvec2& origin,
     const WorldGeometry::geometry_hash& all_geometry)
 {
   // We find all the vertices whose geometries intersect the bounding box of the
@@ -661,16 +916,12 @@ void Lighting::get_planar_relevant_geometry(
       continue;
     }
 
-    geometry_output.emplace_back(g_s, g_e);
-    map_output[g_s].emplace_back(g_s, g_e);
-    map_output[g_e].emplace_back(g_s, g_e);
-  }
-  for (const auto& pair : map_output) {
-    vertex_output.emplace_back(pair.first);
+    output.add_segment(g_s, g_e);
   }
+  output.build();
 
-  vertex_output.emplace_back(y::wvec2{v - offset});
-  vertex_output.emplace_back(y::wvec2{v + offset});
+  output.add_vertex(y::wvec2{v - offset});
+  output.add_vertex(y::wvec2{v + offset});
 }
 
 y::wvec2 Lighting::get_angular_point_on_geometry(
@@ -705,28 +956,22 @@ y::wvec2 Lighting::get_planar_point_on_geometry(
 }
 
 void Lighting::trace_light_geometry(light_trace& output, const Light& light,
-                                    const std::vector<y::wvec2>& vertex_buffer,
-                                    const geometry_entry& geometry_buffer,
-                                    const geometry_map& map, bool planar)
+                                    const geometry_graph& graph,
+                                    geometry_stack& stack, bool planar)
 {
+  stack.reset(graph.segments.size());
   if (planar) {
-    trace_planar_light_geometry(output, light,
-                                vertex_buffer, geometry_buffer, map);
+    trace_planar_light_geometry(output, light, graph, stack);
   }
   else {
-    trace_angular_light_geometry(output, light,
-                                 vertex_buffer, geometry_buffer, map);
+    trace_angular_light_geometry(output, light, graph, stack);
   }
 }
 
 void Lighting::trace_angular_light_geometry(
     light_trace& output, const Light& light,
-    const std::vector<y::wvec2>& vertex_buffer,
-    const geometry_entry& geometry_buffer,
-    const geometry_map& map)
+    const geometry_graph& graph, geometry_stack& stack)
 {
-  geometry_set stack;
-
   // Calculates closest point and geometry.
   auto get_closest = [&](
       world_geometry& closest_geometry_output, const y::wvec2& v)
@@ -769,26 +1014,25 @@ void Lighting::trace_angular_light_geometry(
       return get_angular_point_on_geometry(v, closest_geometry_output);
     }
 
-    const world_geometry* closest_geometry = nullptr;
     y::wvec2 closest_point;
 
     bool first = true;
     y::world min_dist_sq = 0;
-    for (const world_geometry& g : stack) {
+    for (std::size_t segment : stack.segments) {
       // Distance is defined by the intersection of the geometry with the
       // line from the origin to the current vertex.
+      world_geometry g = graph.get_geometry(segment);
       y::wvec2 point = get_angular_point_on_geometry(v, g);
       y::world dist_sq = point.length_squared();
 
       if (first || dist_sq < min_dist_sq) {
         min_dist_sq = dist_sq;
-        closest_geometry = &g;
+        closest_geometry_output = g;
         closest_point = point;
       }
       first = false;
     }
 
-    closest_geometry_output = *closest_geometry;
     return closest_point;
   };
 
@@ -796,11 +1040,13 @@ void Lighting::trace_angular_light_geometry(
   // to the first vertex (but doesn't start exactly on it). To make sure we get
   // only geometry crossing the positive half of the line and not the negative
   // half, make sure line is defined in correct direction.
-  const y::wvec2& first_vec = vertex_buffer[0];
-  for (const world_geometry& g : geometry_buffer) {
+  const y::wvec2& first_vec = graph.vertices[graph.order[0]];
+  for (std::size_t i = 0; i < graph.segments.size(); ++i) {
+    const y::wvec2& start = graph.vertices[graph.segments[i].start];
+    const y::wvec2& end = graph.vertices[graph.segments[i].end];
     // If d_e < 0 && d_s > 0 then line crosses the negative half.
-    if (first_vec.cross(g.start) < 0 && first_vec.cross(g.end) >= 0) {
-      stack.insert(g);
+    if (first_vec.cross(start) < 0 && first_vec.cross(end) >= 0) {
+      stack.insert(i);
     }
   }
 
@@ -814,26 +1060,26 @@ void Lighting::trace_angular_light_geometry(
   // If stack is empty, make sure the first vertex gets added.
   bool add_first = stack.empty();
 
-  for (std::size_t i = 0; i < vertex_buffer.size(); ++i) {
-    const auto& v = vertex_buffer[i];
+  for (std::size_t i = 0; i < graph.order.size(); ++i) {
+    std::size_t index = graph.order[i];
+    const auto& v = graph.vertices[index];
 
     // Add or remove from stack as appropriate.
-    auto it = map.find(v);
-    if (it != map.end()) {
-      for (const world_geometry& g : it->second) {
-        if (v == g.start) {
-          stack.insert(g);
-        }
-        else {
-          stack.erase(g);
-        }
+    for (std::size_t j = graph.adjacency_start[index];
+         j < graph.adjacency_start[1 + index]; ++j) {
+      std::size_t segment = graph.adjacency[j];
+      if (index == graph.segments[segment].start) {
+        stack.insert(segment);
+      }
+      else {
+        stack.erase(segment);
       }
     }
 
     // Determine whether this point represents a new angle or not. If we're on
     // the same line from the origin as the next vertex, skip.
-    if (i < vertex_buffer.size() - 1) {
-      const auto& next = vertex_buffer[1 + i];
+    if (i < graph.order.size() - 1) {
+      const auto& next = graph.vertices[graph.order[1 + i]];
       if (v.cross(next) == 0) {
         continue;
       }
@@ -863,17 +1109,12 @@ void Lighting::trace_angular_light_geometry(
 
 void Lighting::trace_planar_light_geometry(
     light_trace& output, const Light& light,
-    const std::vector<y::wvec2>& vertex_buffer,
-    const geometry_entry& geometry_buffer,
-    const geometry_map& map)
+    const geometry_graph& graph, geometry_stack& stack)
 {
-  geometry_set stack;
-
   // Calculates closest point and geometry.
   auto get_closest = [&](
       world_geometry& closest_geometry_output, const y::wvec2& v)
   {
-    const world_geometry* closest_geometry = nullptr;
     y::wvec2 closest_point;
     // Point on light plane for comparison.
     const y::wvec2 plane_point = get_planar_point_on_geometry(
@@ -882,13 +1123,14 @@ void Lighting::trace_planar_light_geometry(
 
     bool first = true;
     y::world min_dist_sq = 0;
-    for (const world_geometry& g : stack) {
+    for (std::size_t segment : stack.segments) {
+      world_geometry g = graph.get_geometry(segment);
       y::wvec2 point = get_planar_point_on_geometry(light.normal_vec, v, g);
       y::world dist_sq = (point - plane_point).length_squared();
 
       if (first || dist_sq < min_dist_sq) {
         min_dist_sq = dist_sq;
-        closest_geometry = &g;
+        closest_geometry_output = g;
         closest_point = point;
       }
       first = false;
@@ -906,7 +1148,6 @@ void Lighting::trace_planar_light_geometry(
           light.normal_vec, v, closest_geometry_output);
     }
 
-    closest_geometry_output = *closest_geometry;
     return closest_point;
   };
 
@@ -920,12 +1161,14 @@ void Lighting::trace_planar_light_geometry(
 
   // Initialise the stack with geometry that intersects the line from the first
   // vertex towards the light angle (but doesn't start exactly on it).
-  const y::wvec2& first_vec = vertex_buffer[0];
-  for (const world_geometry& g : geometry_buffer) {
+  const y::wvec2& first_vec = graph.vertices[graph.order[0]];
+  for (std::size_t i = 0; i < graph.segments.size(); ++i) {
+    const y::wvec2& start = graph.vertices[graph.segments[i].start];
+    const y::wvec2& end = graph.vertices[graph.segments[i].end];
     // Lines crossing in the opposite direction have already been excluded.
-    if ((g.start - first_vec).cross(light.normal_vec) < 0 &&
-        (g.end - first_vec).cross(light.normal_vec) >= 0) {
-      stack.insert(g);
+    if ((start - first_vec).cross(light.normal_vec) < 0 &&
+        (end - first_vec).cross(light.normal_vec) >= 0) {
+      stack.insert(i);
     }
   }
 
@@ -935,25 +1178,25 @@ void Lighting::trace_planar_light_geometry(
   get_closest(prev_closest_geometry, first_vec);
   bool add_first = stack.empty();
 
-  for (std::size_t i = 0; i < vertex_buffer.size(); ++i) {
-    const auto& v = vertex_buffer[i];
+  for (std::size_t i = 0; i < graph.order.size(); ++i) {
+    std::size_t index = graph.order[i];
+    const auto& v = graph.vertices[index];
 
-    auto it = map.find(v);
-    if (it != map.end()) {
-      for (const world_geometry& g : it->second) {
-        if (v == g.end) {
-          stack.insert(g);
-        }
-        else {
-          stack.erase(g);
-        }
+    for (std::size_t j = graph.adjacency_start[index];
+         j < graph.adjacency_start[1 + index]; ++j) {
+      std::size_t segment = graph.adjacency[j];
+      if (index == graph.segments[segment].end) {
+        stack.insert(segment);
+      }
+      else {
+        stack.erase(segment);
       }
     }
 
     // Determine whether this point represents a new sweep position or not. If
     // we're on the same direction line from plane as next vertex, skip.
-    if (i < vertex_buffer.size() - 1) {
-      const auto& next = vertex_buffer[1 + i];
+    if (i < graph.order.size() - 1) {
+      const auto& next = graph.vertices[graph.order[1 + i]];
       if (v.dot(plane_vec) == next.dot(plane_vec)) {
         continue;
       }
@@ -962,7 +1205,7 @@ void Lighting::trace_planar_light_geometry(
     world_geometry new_closest_geometry;
     y::wvec2 new_closest_point = get_closest(new_closest_geometry, v);
 
-    bool add_last = i == vertex_buffer.size() - 1 && stack.empty();
+    bool add_last = i == graph.order.size() - 1 && stack.empty();
     if (new_closest_geometry == prev_closest_geometry &&
         !add_first && !add_last) {
       continue;
@@ -47,6 +47,11 @@ struct Light {
   // light.
   y::wvec2 normal_vec;
 
+  // Hint that the light rarely changes. Static lights are traced and meshed
+  // over the whole active world rather than just the camera, and the mesh is
+  // kept until one of them moves or changes.
+  bool is_static;
+
   // Handy functions.
   y::world get_max_range() const;
   y::wvec2 get_origin(const y::wvec2& origin) const;
@@ -63,9 +68,25 @@ public:
   Lighting(const WorldWindow& world, GlUtil& gl);
   ~Lighting() override {};
 
+  // Counts and timings for the most recent call to recalculate_traces(), for
+  // benchmarking. The cone time accumulates as meshes are built afterwards.
+  struct trace_stats {
+    trace_stats();
+
+    std::size_t lights;
+    std::size_t traced;
+    std::size_t trace_vertices;
+
+    std::size_t ns_query;
+    std::size_t ns_sort;
+    std::size_t ns_sweep;
+    std::size_t ns_cone;
+  };
+
   // Lighting functions.
   void recalculate_traces(
       const y::wvec2& camera_min, const y::wvec2& camera_max);
+  const trace_stats& get_trace_stats() const;
   void clear_results_and_cache();
 
   void render_traces(
@@ -82,27 +103,83 @@ private:
 
   typedef std::vector<y::wvec2> light_trace;
 
-  // Add all the data for a vertex of a lit shape.
-  void add_vertex(const y::wvec2& origin, const y::wvec2& trace,
-                  const Light& light) const;
-  // Add a triangle by element indices if necessary.
-  void add_triangle(
-      std::vector<GLushort>& element_data,
-      const y::wvec2& min, const y::wvec2& max,
-      std::size_t start_index, std::size_t a, std::size_t b, std::size_t c,
-      const y::wvec2& at, const y::wvec2& bt, const y::wvec2& ct) const;
+  // Range of the element buffer belonging to each light, in draw order.
+  struct element_range {
+    std::size_t offset;
+    std::size_t count;
+  };
+
+  // Vertex and element data for a set of lights. It's uploaded once and then
+  // shared by every lighting layer.
+  struct light_mesh {
+    light_mesh(GlUtil& gl, GLenum usage_hint);
+
+    void clear();
+    void reupload() const;
+
+    // Add all the data for a vertex of a lit shape.
+    void add_vertex(const y::wvec2& light_origin, const y::wvec2& trace,
+                    const Light& light);
+    // Add a triangle by element indices if necessary.
+    void add_triangle(
+        const y::wvec2& min, const y::wvec2& max, bool cull,
+        std::size_t start_index, std::size_t a, std::size_t b, std::size_t c,
+        const y::wvec2& at, const y::wvec2& bt, const y::wvec2& ct);
+
+    GlDatabuffer<float, 2> tri;
+    GlDatabuffer<float, 2> origin;
+    GlDatabuffer<float, 2> range;
+    GlDatabuffer<float, 4> colour;
+    GlDatabuffer<float, 1> layering;
+    GlDatabuffer<GLuint, 1> element;
+    std::vector<element_range> ranges;
+  };
+
+  // Everything about an is_static light which affects its mesh, so that we
+  // can tell when _static_mesh needs rebuilding.
+  struct light_key {
+    light_key(const Light& light, const y::wvec2& origin);
+
+    y::wvec2 origin;
+    y::wvec2 offset;
+    y::world full_range;
+    y::world falloff_range;
+    y::world layer_value;
+    y::fvec4 colour;
+    y::world angle;
+    y::world aperture;
+    y::wvec2 normal_vec;
+
+    bool operator==(const light_key& key) const;
+    bool operator!=(const light_key& key) const;
+  };
 
+  // Rebuilds and uploads _static_mesh if any is_static light has changed.
+  void update_static_mesh();
+  // Rebuilds and uploads the mesh for the remaining lights if the traces or
+  // camera have changed since it was last built.
+  void update_dynamic_mesh(
+      const y::wvec2& camera_min, const y::wvec2& camera_max) const;
   void render_internal(
       RenderUtil& util, const GlFramebuffer& normalbuffer,
       const y::wvec2& camera_min, const y::wvec2& camera_max,
       bool specular) const;
 
-  void render_angular_internal(
-      const light_trace& trace, const Light& light, const y::wvec2& origin,
-      const y::wvec2& camera_min, const y::wvec2& camera_max) const;
-  void render_planar_internal(
-      const light_trace& trace, const Light& light, const y::wvec2& origin,
-      const y::wvec2& camera_min, const y::wvec2& camera_max) const;
+  void add_light_to_mesh(
+      light_mesh& mesh, const Light& light, const Script& source,
+      const y::wvec2& camera_min, const y::wvec2& camera_max,
+      bool cull) const;
+  static void draw_mesh(const GlProgram& program, const light_mesh& mesh,
+                        std::size_t& n, std::size_t total);
+
+  static void add_angular_light(
+      light_mesh& mesh, const light_trace& trace,
+      const Light& light, const y::wvec2& origin,
+      const y::wvec2& min, const y::wvec2& max, bool cull);
+  static void add_planar_light(
+      light_mesh& mesh, const light_trace& trace,
+      const Light& light, const y::wvec2& origin,
+      const y::wvec2& min, const y::wvec2& max, bool cull);
 
   // Stores trace results. Trace is relative to origin.
   struct trace_key {
@@ -134,28 +211,76 @@ private:
     y::wvec2 start;
     y::wvec2 end;
   };
-  struct world_geometry_hash {
-    std::size_t operator()(const world_geometry& g) const;
+
+  // Compact indexed representation of the geometry relevant to a light. Each
+  // distinct vertex is stored once, segments refer to their endpoints by index,
+  // and the segments touching each vertex are stored contiguously (in CSR
+  // form), so no per-vertex allocations are needed. The buffers are kept around
+  // and reused for every light.
+  struct geometry_graph {
+    struct segment {
+      std::size_t start;
+      std::size_t end;
+    };
+
+    // Remove everything, but keep the allocated storage.
+    void clear();
+    // Add a segment. Once all segments have been added, build() must be
+    // called to merge vertices and compute the adjacency.
+    void add_segment(const y::wvec2& start, const y::wvec2& end);
+    void build();
+    // Add an extra vertex with no adjacent segments. Must be called after
+    // build().
+    void add_vertex(const y::wvec2& v);
+
+    world_geometry get_geometry(std::size_t segment) const;
+
+    std::vector<y::wvec2> vertices;
+    std::vector<segment> segments;
+
+    // The segments adjacent to vertex i are given by the elements of adjacency
+    // in [adjacency_start[i], adjacency_start[1 + i]).
+    std::vector<std::size_t> adjacency_start;
+    std::vector<std::size_t> adjacency;
+
+    // Vertex indices in sweep order.
+    std::vector<std::size_t> order;
+
+    // Scratch space for merging vertices in build().
+    struct endpoint {
+      y::wvec2 v;
+      std::size_t segment;
+      bool start;
+    };
+    std::vector<endpoint> endpoints;
+  };
+
+  // Set of segment indices with constant-time insertion and removal, used as
+  // the sweep stack when tracing.
+  struct geometry_stack {
+    // Clear and prepare for segment indices less than size.
+    void reset(std::size_t size);
+    void insert(std::size_t segment);
+    void erase(std::size_t segment);
+    bool empty() const;
+
+    std::vector<std::size_t> segments;
+    // Position of each segment in the segments list, or -1 if not present.
+    std::vector<std::size_t> positions;
   };
-  typedef std::vector<world_geometry> geometry_entry;
-  typedef std::unordered_map<y::wvec2, geometry_entry> geometry_map;
-  typedef std::unordered_set<world_geometry, world_geometry_hash> geometry_set;
 
   // Pair of functions for finding all vertices and geometries that might
   // affect the light output in the angular and planar settings.
   static void get_relevant_geometry(
-      std::vector<y::wvec2>& vertex_output, geometry_entry& geometry_output,
-      geometry_map& map_output, const Light& light, const y::wvec2& origin,
+      geometry_graph& output, const Light& light, const y::wvec2& origin,
       const WorldGeometry::geometry_hash& all_geometry, bool planar);
 
   static void get_angular_relevant_geometry(
-      std::vector<y::wvec2>& vertex_output, geometry_entry& geometry_output,
-      geometry_map& map_output, const Light& light, const y::wvec2& origin,
+      geometry_graph& output, const Light& light, const y::wvec2& origin,
       const WorldGeometry::geometry_hash& all_geometry);
 
   static void get_planar_relevant_geometry(
-      std::vector<y::wvec2>& vertex_output, geometry_entry& geometry_output,
-      geometry_map& map_output, const Light& light, const y::wvec2& origin,
+      geometry_graph& output, const Light& light, const y::wvec2& origin,
       const WorldGeometry::geometry_hash& all_geometry);
 
   // Helper functions.
@@ -165,23 +290,19 @@ private:
       const y::wvec2& normal_vec, const y::wvec2& v,
       const world_geometry& geometry);
 
-  // Pair of functions for tracing angular and planar light geometry.
+  // Pair of functions for tracing angular and planar light geometry. The
+  // graph's vertex order must already be sorted.
   static void trace_light_geometry(light_trace& output, const Light& light,
-                                   const std::vector<y::wvec2>& vertex_buffer,
-                                   const geometry_entry& geometry_buffer,
-                                   const geometry_map& map, bool planar);
+                                   const geometry_graph& graph,
+                                   geometry_stack& stack, bool planar);
 
   static void trace_angular_light_geometry(
       light_trace& output, const Light& light,
-      const std::vector<y::wvec2>& vertex_buffer,
-      const geometry_entry& geometry_buffer,
-      const geometry_map& map);
+      const geometry_graph& graph, geometry_stack& stack);
 
   static void trace_planar_light_geometry(
       light_trace& output, const Light& light,
-      const std::vector<y::wvec2>& vertex_buffer,
-      const geometry_entry& geometry_buffer,
-      const geometry_map& map);
+      const geometry_graph& graph, geometry_stack& stack);
 
   // Converts a point-light trace into a cone-light trace.
   static void make_cone_trace(light_trace& output, const light_trace& trace,
@@ -192,16 +313,20 @@ private:
   GlUnique<GlProgram> _light_program;
   GlUnique<GlProgram> _light_specular_program;
 
-  GlDatabuffer<float, 2> _tri;
-  GlDatabuffer<float, 2> _origin;
-  GlDatabuffer<float, 2> _range;
-  GlDatabuffer<float, 4> _colour;
-  GlDatabuffer<float, 1> _layering;
+  light_mesh _static_mesh;
+  std::vector<light_key> _static_keys;
+  std::vector<light_key> _static_keys_next;
+  bool _static_mesh_dirty;
 
-  mutable std::vector<std::vector<GLushort>> _element_data;
-  GlUnique<GlBuffer<GLushort, 1>> _element_buffer;
+  mutable light_mesh _dynamic_mesh;
+  mutable bool _dynamic_mesh_dirty;
+  mutable y::wvec2 _mesh_camera_min;
+  mutable y::wvec2 _mesh_camera_max;
 
   trace_results _trace_results;
+  geometry_graph _graph;
+  geometry_stack _stack;
+  mutable trace_stats _stats;
 
 };
 
@@ -9,21 +9,21 @@ namespace {
 
 void save_to_proto(const LuaValue& value, proto::Value& proto)
 {
-  if (value.type == LuaValue::WORLD) {
+  if (value.type() == LuaValue::WORLD) {
     proto.set_type(proto::WORLD);
-    proto.set_world_value(value.world);
+    proto.set_world_value(value.world());
   }
-  else if (value.type == LuaValue::BOOLEAN) {
+  else if (value.type() == LuaValue::BOOLEAN) {
     proto.set_type(proto::BOOLEAN);
-    proto.set_boolean_value(value.boolean);
+    proto.set_boolean_value(value.boolean());
   }
-  else if (value.type == LuaValue::STRING) {
+  else if (value.type() == LuaValue::STRING) {
     proto.set_type(proto::STRING);
-    proto.set_string_value(value.string);
+    proto.set_string_value(value.string(), value.string_size());
   }
-  else if (value.type == LuaValue::ARRAY) {
+  else if (value.type() == LuaValue::ARRAY) {
     proto.set_type(proto::ARRAY);
-    for (const auto& v : value.array) {
+    for (const auto& v : value.array()) {
       auto proto_v = proto.add_array_value();
       save_to_proto(v, *proto_v);
     }
@@ -33,32 +33,26 @@ void save_to_proto(const LuaValue& value, proto::Value& proto)
   }
 }
 
-void load_from_proto(LuaValue& value, const proto::Value& proto)
+LuaValue load_from_proto(const proto::Value& proto)
 {
   if (proto.type() == proto::WORLD) {
-    value.type = LuaValue::WORLD;
-    value.world = proto.world_value();
+    return LuaValue(proto.world_value());
   }
   else if (proto.type() == proto::BOOLEAN) {
-    value.type = LuaValue::BOOLEAN;
-    value.boolean = proto.boolean_value();
+    return LuaValue(proto.boolean_value());
   }
   else if (proto.type() == proto::STRING) {
-    value.type = LuaValue::STRING;
-    value.string = proto.string_value();
+    return LuaValue(proto.string_value());
   }
   else if (proto.type() == proto::ARRAY) {
-    value.type = LuaValue::ARRAY;
-    while (std::int32_t(value.array.size()) < proto.array_value_size()) {
-      value.array.emplace_back(0.0);
-    }
+    LuaValue::array_type array;
     for (std::int32_t i = 0; i < proto.array_value_size(); ++i) {
-      load_from_proto(value.array[i], proto.array_value(i));
+      array.emplace_back(load_from_proto(proto.array_value(i)));
     }
+    return LuaValue(std::move(array));
   }
-  else {
-    log_err("Loading savegame value with invalid type");
-  }
+  log_err("Loading savegame value with invalid type");
+  return LuaValue(0.);
 }
 
 // End anonymous namespace.
@@ -98,15 +92,25 @@ const LuaValue& Savegame::get(const std::string& key) const
 }
 
 void Savegame::put(const std::string& key, const LuaValue& value)
+{
+  put(key, LuaValue(value));
+}
+
+void Savegame::put(const std::string& key, LuaValue&& value)
 {
   // We can't handle arbitrary userdata types. It might be possible to provide
   // an exception for two-dimensional vectors for convenience.
-  if (value.type == LuaValue::USERDATA) {
+  if (value.type() == LuaValue::USERDATA) {
     log_err("Tried to write userdata into savegame");
     return;
   }
-  _map.erase(key);
-  _map.emplace(key, value);
+  auto it = _map.find(key);
+  if (it == _map.end()) {
+    _map.emplace(key, std::move(value));
+  }
+  else {
+    it->second = std::move(value);
+  }
 }
 
 void Savegame::save_to_proto(const Databank&, proto::Savegame& proto) const
@@ -123,8 +127,7 @@ void Savegame::load_from_proto(Databank&, const proto::Savegame& proto)
   clear();
 
   for (std::int32_t i = 0; i < proto.entries_size(); ++i) {
-    LuaValue value(0.0);
-    ::load_from_proto(value, proto.entries(i).value());
-    put(proto.entries(i).key(), value);
+    put(proto.entries(i).key(),
+        ::load_from_proto(proto.entries(i).value()));
   }
 }
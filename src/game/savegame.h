@@ -31,7 +31,9 @@ public:
 
   void clear();
   const LuaValue& get(const std::string& key) const;
+  // Values are cheap to copy (see LuaValue), but can also be moved in.
   void put(const std::string& key, const LuaValue& value);
+  void put(const std::string& key, LuaValue&& value);
 
 protected:
 
@@ -10,12 +10,16 @@
 #include "../render/gl_util.h"
 #include "../render/window.h"
 
+#include <algorithm>
 #include <boost/functional/hash.hpp>
+#include <cstring>
 
 ScriptBank::ScriptBank(GameStage& stage)
   : _stage(stage)
   , _spatial_hash(128)
   , _uid_unused({0})
+  , _message_queue(0)
+  , _deferring(false)
 {
 }
 
@@ -27,7 +31,8 @@ Script& ScriptBank::create_script(const LuaFile& file, const y::wvec2& origin)
 Script& ScriptBank::create_script(
     const LuaFile& file, const y::wvec2& origin, const y::wvec2& region)
 {
-  Script* s = new Script(_stage, file.path, file.contents, origin, region);
+  Script* s = new Script(_stage.get_lua(),
+                         file.path, file.get_chunk(), origin, region);
   add_script(std::unique_ptr<Script>(s));
   return *s;
 }
@@ -71,10 +76,16 @@ std::int32_t ScriptBank::get_uid(const Script* script) const
   return uid;
 }
 
-void ScriptBank::send_message(Script* script, const std::string& function_name,
-                              const std::vector<LuaValue>& args)
+void ScriptBank::send_message(Script* script, const char* function_name,
+                              const LuaStackArgs& args)
 {
-  _messages.push_back({script, function_name, args});
+  message_queue& queue = _message_queues[_message_queue];
+  message m{script, intern_message_function(function_name),
+            queue.values.size(), args.size()};
+  for (lua_int i = 0; i < m.arg_count; ++i) {
+    store_message_value(args.state, args.first + i);
+  }
+  queue.messages.emplace_back(m);
 }
 
 void ScriptBank::update_spatial_hash(Script* source)
@@ -82,26 +93,72 @@ void ScriptBank::update_spatial_hash(Script* source)
   _spatial_hash.update(source, source->get_origin(), source->get_origin());
 }
 
-void ScriptBank::update_all() const
+bool ScriptBank::is_deferring() const
+{
+  return _deferring;
+}
+
+void ScriptBank::update_all()
 {
+  _stage.get_lua().get_profiler().frame();
+  // The scripts all share one Lua state, so update_parallel functions still
+  // run one at a time; but since they only see the world as it was at the
+  // start, they could be run in any order.
+  _deferring = true;
+  for (const auto& script : _scripts) {
+    if (!script->is_destroyed()) {
+      script->call(Script::HOOK_UPDATE_PARALLEL);
+    }
+  }
+  _deferring = false;
+  for (const auto& command : _commands) {
+    command();
+  }
+  _commands.clear();
+
   // Destructions won't happen here. Iteration is fine even though new
   // scripts may be added in the loop, since we're using a doubly-linked
   // list.
   for (const auto& script : _scripts) {
-    if (script->has_function("update") && !script->is_destroyed()) {
-      script->call("update");
+    if (!script->is_destroyed()) {
+      script->call(Script::HOOK_UPDATE);
     }
   }
 }
 
 void ScriptBank::handle_messages()
 {
-  for (const auto& m : _messages) {
-    if (m.script->has_function(m.function_name)) {
-      m.script->call(m.function_name, m.args);
+  // Messages sent by the handlers go to the other queue, and are handled next
+  // frame.
+  message_queue& queue = _message_queues[_message_queue];
+  _message_queue = 1 - _message_queue;
+  for (std::size_t i = 0; i < queue.messages.size(); ++i) {
+    // The Script may have been destroyed by an earlier handler.
+    message m = queue.messages[i];
+    if (!m.script) {
+      continue;
+    }
+    const message_function& f = _message_functions[m.function];
+    bool hook = f.hook != Script::HOOK_COUNT;
+    if (hook && !m.script->has_function(f.hook)) {
+      continue;
+    }
+    lua_State* state = m.script->get_vm().get_state();
+    std::size_t index = m.args;
+    for (lua_int j = 0; j < m.arg_count; ++j) {
+      index = push_message_value(state, queue, index);
+    }
+    if (hook) {
+      m.script->call_pushed(f.hook, m.arg_count);
+    }
+    else {
+      m.script->call_pushed(f.name, m.arg_count);
     }
   }
-  _messages.clear();
+  queue.messages.clear();
+  queue.values.clear();
+  queue.chars.clear();
+  queue.others.clear();
 }
 
 void ScriptBank::move_all(const y::wvec2& move, Collision& collision)
@@ -120,9 +177,8 @@ void ScriptBank::render_all(const Camera& camera) const
   for (const auto& script : _scripts) {
     const y::wvec2 min = script->get_origin() - script->get_region() / 2;
     const y::wvec2 max = script->get_origin() + script->get_region() / 2;
-    if (max > camera.get_min() && min < camera.get_max() &&
-        script->has_function("draw")) {
-      script->call("draw");
+    if (max > camera.get_min() && min < camera.get_max()) {
+      script->call(Script::HOOK_DRAW);
     }
   }
 }
@@ -255,8 +311,8 @@ void ScriptBank::create_in_bounds(
     if (overlaps_world && !overlaps_preserved &&
         _script_map.find(key) == _script_map.end()) {
       const LuaFile& file = bank.scripts.get(ws.path);
-      Script* script =
-          new Script(_stage, file.path, file.contents, ws.origin, ws.region);
+      Script* script = new Script(_stage.get_lua(), file.path,
+                                  file.get_chunk(), ws.origin, ws.region);
       _script_map.emplace(key, *script);
       add_script(std::unique_ptr<Script>(script));
     }
@@ -273,6 +329,8 @@ void ScriptBank::add_script(std::unique_ptr<Script> script)
               &_spatial_hash, std::placeholders::_1));
   script->add_destroy_callback(
       std::bind(&ScriptBank::release_uid, this, std::placeholders::_1));
+  script->add_destroy_callback(
+      std::bind(&ScriptBank::drop_messages, this, std::placeholders::_1));
 
   _scripts.emplace_back();
   (_scripts.rbegin())->swap(script);
@@ -288,6 +346,143 @@ void ScriptBank::release_uid(Script* script)
   _uid_map.erase(it);
 }
 
+void ScriptBank::drop_messages(Script* script)
+{
+  for (message_queue& queue : _message_queues) {
+    for (message& m : queue.messages) {
+      if (m.script == script) {
+        m.script = nullptr;
+      }
+    }
+  }
+}
+
+std::size_t ScriptBank::intern_message_function(const char* name)
+{
+  auto it = _message_function_ids.find(name);
+  if (it != _message_function_ids.end()) {
+    return it->second;
+  }
+  std::size_t id = _message_functions.size();
+  _message_functions.push_back({name, Script::get_hook(name)});
+  // The deque never moves its elements, so the key stays valid.
+  _message_function_ids.emplace(_message_functions.back().name.c_str(), id);
+  return id;
+}
+
+void ScriptBank::store_message_value(lua_State* state, lua_int index)
+{
+  // Same precedence as LuaType<LuaValue>: numeric strings are numbers.
+  message_queue& queue = _message_queues[_message_queue];
+  message_value v;
+  v.size = 0;
+  LuaType<y::wvec2> vec;
+  if (lua_isnumber(state, index)) {
+    v.type = message_value::WORLD;
+    v.world = lua_tonumber(state, index);
+  }
+  else if (lua_isboolean(state, index)) {
+    v.type = message_value::BOOLEAN;
+    v.boolean = lua_toboolean(state, index);
+  }
+  else if (lua_isstring(state, index)) {
+    std::size_t length = 0;
+    const char* s = lua_tolstring(state, index, &length);
+    v.type = message_value::STRING;
+    v.size = length;
+    v.offset = queue.chars.size();
+    queue.chars.insert(queue.chars.end(), s, s + length);
+  }
+  else if (vec.is(state, index)) {
+    const y::wvec2& u = vec.get(state, index);
+    v.type = message_value::VEC;
+    v.vec[0] = u[xx];
+    v.vec[1] = u[yy];
+  }
+  else if (lua_istable(state, index)) {
+    const void* table = lua_topointer(state, index);
+    if (std::find(_message_tables.begin(), _message_tables.end(), table) !=
+        _message_tables.end()) {
+      log_err("Message argument table contains itself");
+      v.type = message_value::NIL;
+      queue.values.emplace_back(v);
+      return;
+    }
+    _message_tables.emplace_back(table);
+
+    // The elements follow, so the size is filled in afterwards.
+    std::size_t position = queue.values.size();
+    v.type = message_value::ARRAY;
+    queue.values.emplace_back(v);
+    std::uint32_t size = 0;
+    while (true) {
+      lua_rawgeti(state, index, 1 + size);
+      if (lua_isnil(state, -1)) {
+        lua_pop(state, 1);
+        break;
+      }
+      store_message_value(state, lua_gettop(state));
+      lua_pop(state, 1);
+      ++size;
+    }
+    queue.values[position].size = size;
+    _message_tables.pop_back();
+    return;
+  }
+  else if (lua_isuserdata(state, index)) {
+    v.type = message_value::OTHER;
+    v.offset = queue.others.size();
+    queue.others.emplace_back(LuaType<LuaValue>().get(state, index));
+  }
+  else {
+    v.type = message_value::NIL;
+  }
+  queue.values.emplace_back(v);
+}
+
+std::size_t ScriptBank::push_message_value(
+    lua_State* state, const message_queue& queue, std::size_t index) const
+{
+  const message_value& v = queue.values[index++];
+  switch (v.type) {
+    case message_value::WORLD:
+      lua_pushnumber(state, v.world);
+      break;
+    case message_value::BOOLEAN:
+      lua_pushboolean(state, v.boolean);
+      break;
+    case message_value::STRING:
+      lua_pushlstring(state, queue.chars.data() + v.offset, v.size);
+      break;
+    case message_value::VEC:
+      LuaType<y::wvec2>().push(state, y::wvec2{v.vec[0], v.vec[1]});
+      break;
+    case message_value::ARRAY:
+      lua_createtable(state, v.size, 0);
+      for (std::uint32_t i = 0; i < v.size; ++i) {
+        index = push_message_value(state, queue, index);
+        lua_rawseti(state, -2, 1 + i);
+      }
+      break;
+    case message_value::OTHER:
+      LuaType<LuaValue>().push(state, queue.others[v.offset]);
+      break;
+    default:
+      lua_pushnil(state);
+  }
+  return index;
+}
+
+std::size_t ScriptBank::c_str_hash::operator()(const char* s) const
+{
+  return boost::hash_range(s, s + std::strlen(s));
+}
+
+bool ScriptBank::c_str_equal::operator()(const char* a, const char* b) const
+{
+  return !std::strcmp(a, b);
+}
+
 bool ScriptBank::script_map_key::operator==(const script_map_key& key) const
 {
   return source == key.source &&
@@ -322,6 +517,7 @@ GameRenderer::GameRenderer(RenderUtil& util, const GlFramebuffer& framebuffer)
         framebuffer.get_size(), false, true))
   , _lightbuffer(util.get_gl().make_unique_framebuffer(
         framebuffer.get_size(), false, true))
+  , _light_quality(LIGHT_QUALITY_FULL)
   , _scene_program(util.get_gl().make_unique_program({
         "/shaders/light/scene.v.glsl",
         "/shaders/light/scene.f.glsl"}))
@@ -329,6 +525,8 @@ GameRenderer::GameRenderer(RenderUtil& util, const GlFramebuffer& framebuffer)
         "/shaders/light/scene_specular.v.glsl",
         "/shaders/light/scene_specular.f.glsl"}))
   , _current_draw_pass(draw_pass(0))
+  , _record_draw_calls(true)
+  , _recording_draw_calls(false)
 {
 }
 
@@ -342,6 +540,84 @@ const GlFramebuffer& GameRenderer::get_framebuffer() const
   return _framebuffer;
 }
 
+void GameRenderer::set_light_quality(light_quality quality)
+{
+  if (quality != LIGHT_QUALITY_HALF && quality != LIGHT_QUALITY_QUARTER) {
+    quality = LIGHT_QUALITY_FULL;
+  }
+  if (quality == _light_quality) {
+    return;
+  }
+  _light_quality = quality;
+  y::ivec2 size = y::max(y::ivec2{1, 1},
+                         _framebuffer.get_size() / std::int32_t(quality));
+  _lightbuffer.swap(_util.get_gl().make_unique_framebuffer(size, false, true));
+}
+
+GameRenderer::light_quality GameRenderer::get_light_quality() const
+{
+  return _light_quality;
+}
+
+void GameRenderer::set_record_draw_calls(bool record)
+{
+  _record_draw_calls = record;
+}
+
+bool GameRenderer::get_record_draw_calls() const
+{
+  return _record_draw_calls;
+}
+
+void GameRenderer::render_sprite(
+    std::int32_t layer, const Sprite& sprite, const y::ivec2& frame_size,
+    const y::fvec2& origin, const y::ivec2& frame,
+    float depth, float rotation, const y::fvec4& colour) const
+{
+  sprite_command command{
+      &sprite, frame_size, origin, frame, depth, rotation, colour};
+  draw_list* list = get_recording_list(layer);
+  if (list) {
+    list->push_back({DRAW_COMMAND_SPRITE, _sprite_commands.size()});
+    _sprite_commands.emplace_back(command);
+  }
+  else if (draw_pass_is_layer(draw_layer(layer))) {
+    draw_sprite(command);
+  }
+}
+
+void GameRenderer::render_fog(
+    const Environment& environment, std::int32_t layer,
+    const y::wvec2& origin, const y::wvec2& region,
+    const Environment::fog_params& params) const
+{
+  fog_command command{origin, region, params};
+  draw_list* list = get_recording_list(layer);
+  if (list) {
+    list->push_back({DRAW_COMMAND_FOG, _fog_commands.size()});
+    _fog_commands.emplace_back(command);
+  }
+  else if (draw_pass_is_layer(draw_layer(layer))) {
+    draw_fog(environment, command);
+  }
+}
+
+void GameRenderer::render_reflect(
+    const Environment& environment, std::int32_t layer,
+    const y::wvec2& origin, const y::wvec2& region,
+    const Environment::reflect_params& params) const
+{
+  reflect_command command{origin, region, params};
+  draw_list* list = get_recording_list(layer);
+  if (list) {
+    list->push_back({DRAW_COMMAND_REFLECT, _reflect_commands.size()});
+    _reflect_commands.emplace_back(command);
+  }
+  else if (draw_pass_is_layer(draw_layer(layer))) {
+    draw_reflect(environment, command);
+  }
+}
+
 RenderBatch& GameRenderer::get_current_batch() const
 {
   return _current_batch;
@@ -420,6 +696,29 @@ void GameRenderer::render(
   _util.add_translation(translation);
   _framebuffer.bind(true, true);
 
+  // If we're recording draw calls, call every script's draw function up-front
+  // so we know which layers have anything in them. Otherwise, we have to assume
+  // they all do.
+  std::vector<bool> layers_used(DRAW_LAYER_MAX, !_record_draw_calls);
+  if (_record_draw_calls) {
+    for (draw_list& list : _draw_lists) {
+      list.clear();
+    }
+    _sprite_commands.clear();
+    _fog_commands.clear();
+    _reflect_commands.clear();
+
+    _recording_draw_calls = true;
+    scripts.render_all(camera);
+    _recording_draw_calls = false;
+
+    for (std::size_t i = 0; i < DRAW_LAYER_MAX; ++i) {
+      layers_used[i] = !_draw_lists[i].empty();
+    }
+    layers_used[DRAW_WORLD] = true;
+    environment.get_physics_layers(layers_used);
+  }
+
   // Loop through the draw passes. Each pass is one loop through everything
   // that can be rendered, but we combine several passes into one semantic
   // layer. For example, some layers need both a colour pass and a normal or
@@ -427,6 +726,13 @@ void GameRenderer::render(
   for (_current_draw_pass = draw_pass(0);
        _current_draw_pass < DRAW_PASS_MAX;
        _current_draw_pass = draw_pass(1 + _current_draw_pass)) {
+    // Skipping an empty layer is the same as rendering it, since nothing gets
+    // composited into the framebuffer unless something is drawn.
+    draw_layer layer = draw_pass_layer();
+    if (layer != DRAW_LAYER_MAX && !layers_used[layer]) {
+      continue;
+    }
+
     // Render colour buffer or normal buffer as appropriate.
     _current_batch.clear();
     _current_draw_any = false;
@@ -446,7 +752,12 @@ void GameRenderer::render(
     // Dividing scripts into a separate batch is probably necessary for some
     // reason I can't remember.
     _current_batch.clear();
-    scripts.render_all(camera);
+    if (_record_draw_calls) {
+      replay_draw_list(environment);
+    }
+    else {
+      scripts.render_all(camera);
+    }
     if (draw_pass_is_normal()) {
       environment.render_physics_normal(*this);
     }
@@ -513,48 +824,165 @@ GameRenderer::layer_light_type GameRenderer::draw_pass_light_type() const
   return LIGHT_TYPE_NORMAL;
 }
 
+GameRenderer::draw_layer GameRenderer::draw_pass_layer() const
+{
+  for (std::size_t i = 0; i < DRAW_LAYER_MAX; ++i) {
+    if (draw_pass_is_layer(draw_layer(i))) {
+      return draw_layer(i);
+    }
+  }
+  return DRAW_LAYER_MAX;
+}
+
+GameRenderer::draw_list* GameRenderer::get_recording_list(
+    std::int32_t layer) const
+{
+  if (!_recording_draw_calls || layer < 0 || layer >= DRAW_LAYER_MAX) {
+    return nullptr;
+  }
+  return &_draw_lists[layer];
+}
+
+void GameRenderer::draw_sprite(const sprite_command& command) const
+{
+  bool normal = draw_pass_is_normal();
+  const Sprite& sprite = *command.sprite;
+
+  set_current_draw_any();
+  _current_batch.add_sprite(
+      RenderBatch::sprite_sheet(sprite, normal), command.frame_size, normal,
+      command.origin, command.frame,
+      command.depth, command.rotation, command.colour);
+}
+
+void GameRenderer::draw_fog(const Environment& environment,
+                            const fog_command& command) const
+{
+  set_current_draw_any();
+  if (draw_pass_is_normal()) {
+    environment.render_fog_normal(
+        _util, command.origin, command.region, command.params);
+  }
+  else if (!command.params.normal_only) {
+    environment.render_fog_colour(
+        _util, command.origin, command.region, command.params);
+  }
+}
+
+void GameRenderer::draw_reflect(const Environment& environment,
+                                const reflect_command& command) const
+{
+  set_current_draw_any();
+  if (draw_pass_is_normal()) {
+    environment.render_reflect_normal(
+        _util, command.origin, command.region, command.params);
+  }
+  else if (!command.params.normal_only) {
+    environment.render_reflect_colour(
+        _util, command.origin, command.region, command.params, _framebuffer);
+  }
+}
+
+void GameRenderer::replay_draw_list(const Environment& environment) const
+{
+  draw_layer layer = draw_pass_layer();
+  if (layer == DRAW_LAYER_MAX) {
+    return;
+  }
+  for (const draw_command& command : _draw_lists[layer]) {
+    switch (command.type) {
+      case DRAW_COMMAND_SPRITE:
+        draw_sprite(_sprite_commands[command.index]);
+        break;
+      case DRAW_COMMAND_FOG:
+        draw_fog(environment, _fog_commands[command.index]);
+        break;
+      case DRAW_COMMAND_REFLECT:
+        draw_reflect(environment, _reflect_commands[command.index]);
+        break;
+    }
+  }
+}
+
+const GameRenderer::tile_cache& GameRenderer::get_tile_cache(
+    const Cell& cell) const
+{
+  // The only render cache we ever set on a cell is a tile_cache.
+  tile_cache* cache =
+      static_cast<tile_cache*>(cell.get_render_cache());
+  if (cache) {
+    return *cache;
+  }
+  cache = new tile_cache;
+  cell.set_render_cache(std::unique_ptr<Cell::render_cache>(cache));
+
+  // Tiles are positioned relative to the cell, so the buffers don't depend on
+  // where the cell is in the active window. Tilesets packed into the same
+  // atlas page share a buffer.
+  std::map<GLuint, tile_cache::entry> entries;
+  std::map<GLuint, RenderBatch::batched_sprite_list> sprites;
+  for (auto it = y::cartesian(Cell::cell_size); it; ++it) {
+    y::fvec2 origin = y::fvec2(Tileset::tile_size * *it);
+
+    for (std::int32_t layer = -Cell::background_layers;
+         layer <= Cell::foreground_layers; ++layer) {
+      const Tile& t = cell.get_tile(layer, *it);
+      if (!t.tileset) {
+        continue;
+      }
+      // Foreground: .4
+      // Collision layer: .5
+      // Background: .6
+      float d = .5f - layer * .1f;
+      const Sprite& texture = t.tileset->get_texture();
+      RenderBatch::sheet sheet = RenderBatch::sprite_sheet(texture, false);
+      GLuint handle = sheet.texture.get_handle();
+      if (entries.find(handle) == entries.end()) {
+        entries.emplace(handle, tile_cache::entry{
+            sheet.texture, RenderBatch::sprite_sheet(texture, true).texture,
+            std::unique_ptr<BatchBuffer>()});
+      }
+
+      sprites[handle].push_back(RenderBatch::make_sprite(
+          sheet, Tileset::tile_size, origin,
+          t.tileset->from_index(t.index), d, 0.f, colour::white));
+    }
+  }
+
+  for (auto& pair : entries) {
+    tile_cache::entry& e = pair.second;
+    e.buffer.reset(new BatchBuffer(_util.get_gl(), GL_STATIC_DRAW));
+    _util.write_batch(*e.buffer, sprites[pair.first]);
+    cache->entries.emplace_back(std::move(e));
+  }
+  return *cache;
+}
+
 void GameRenderer::render_tiles(
     const Camera& camera, const WorldWindow& world) const
 {
   _current_draw_any = true;
+  bool normal = draw_pass_is_normal();
 
-  // Render all the tiles in the world at once, batched by texture. We could
-  // potentially store two renderbatches and only recompute this when the
-  // world changes. (And store the OpenGL buffer so it doesn't need to be
-  // reuploaded every frame either.)
+  // Render the cached tile buffers of each visible cell, offset to the cell's
+  // position in the active window.
   for (auto it = world.get_cartesian(); it; ++it) {
     Cell* cell = world.get_active_window_cell(*it);
     if (!cell) {
       continue;
     }
-    for (auto jt = y::cartesian(Cell::cell_size); jt; ++jt) {
-      y::ivec2 w = Tileset::tile_size * (*jt + *it * Cell::cell_size);
-      if (y::wvec2(w + Tileset::tile_size) <= camera.get_min() ||
-          y::wvec2(w) >= camera.get_max()) {
-        continue;
-      }
+    y::ivec2 w = Tileset::tile_size * Cell::cell_size * *it;
+    if (y::wvec2(w + Tileset::tile_size * Cell::cell_size) <=
+            camera.get_min() || y::wvec2(w) >= camera.get_max()) {
+      continue;
+    }
 
-      for (std::int32_t layer = -Cell::background_layers;
-           layer <= Cell::foreground_layers; ++layer) {
-        const Tile& t = cell->get_tile(layer, *jt);
-        if (!t.tileset) {
-          continue;
-        }
-        // Foreground: .4
-        // Collision layer: .5
-        // Background: .6
-        float d = .5f - layer * .1f;
-        bool normal = draw_pass_is_normal();
-
-        const GlTexture2D texture = normal ?
-            t.tileset->get_texture().normal : t.tileset->get_texture().texture;
-
-        _current_batch.add_sprite(
-            texture, Tileset::tile_size, normal,
-            y::fvec2(w), t.tileset->from_index(t.index),
-            d, 0.f, colour::white);
-      }
+    y::fvec2 translation = y::fvec2(w) * _util.get_scale();
+    _util.add_translation(translation);
+    for (const tile_cache::entry& e : get_tile_cache(*cell).entries) {
+      _util.render_batch(normal ? e.normal : e.texture, normal, *e.buffer);
     }
+    _util.add_translation(-translation);
   }
 }
 
@@ -570,6 +998,10 @@ void GameRenderer::render_scene(layer_light_type light_type) const
   program.bind_attribute("position", _util.quad_vertex());
   program.bind_uniform("colourbuffer", *_colourbuffer);
   program.bind_uniform("lightbuffer", *_lightbuffer);
+  program.bind_uniform("normalbuffer", *_normalbuffer);
+  program.bind_uniform("lightbuffer_size", y::fvec2(_lightbuffer->get_size()));
+  program.bind_uniform("lightbuffer_upsample",
+                       _light_quality != LIGHT_QUALITY_FULL);
   _util.quad_element().draw_elements(GL_TRIANGLE_STRIP, 4);
 }
 
@@ -705,6 +1137,7 @@ GameStage::GameStage(const Databank& bank, Filesystem& save_filesystem,
   , _world(get_source(source_key),
            y::ivec2(coord + y::wvec2{.5, .5}).euclidean_div(
                Tileset::tile_size * Cell::cell_size))
+  , _lua(*this)
   , _scripts(*this)
   , _renderer(util, framebuffer)
   , _camera(framebuffer.get_size())
@@ -713,7 +1146,14 @@ GameStage::GameStage(const Databank& bank, Filesystem& save_filesystem,
   , _lighting(new Lighting(_world, util.get_gl()))
   , _environment(new Environment(util.get_gl(), _world, fake))
   , _player(nullptr)
+  , _run_timing(nullptr)
 {
+  // Garbage is collected at the end of each update instead, so that it
+  // doesn't cause spikes. Fake stages are never updated.
+  if (!fake) {
+    _lua.set_automatic_gc(false);
+  }
+
   const LuaFile& file = _bank.scripts.get("/scripts/game/player.lua");
   y::wvec2 offset = y::wvec2(_world.get_active_coord() *
                              Cell::cell_size * Tileset::tile_size);
@@ -762,6 +1202,16 @@ Savegame& GameStage::get_savegame()
   return *_savegame;
 }
 
+const LuaVm& GameStage::get_lua() const
+{
+  return _lua;
+}
+
+LuaVm& GameStage::get_lua()
+{
+  return _lua;
+}
+
 const ScriptBank& GameStage::get_scripts() const
 {
   return _scripts;
@@ -864,11 +1314,11 @@ void GameStage::event(const sf::Event& e)
         break;
       }
     }
-    if (b && get_player()->has_function("key")) {
-      std::vector<LuaValue> args;
-      args.emplace_back(y::world(pair.first));
-      args.emplace_back(e.type == sf::Event::KeyPressed);
-      get_player()->call("key", args);
+    if (b && get_player()->has_function(Script::HOOK_KEY)) {
+      lua_State* state = get_player()->get_vm().get_state();
+      LuaType<y::world>().push(state, y::world(pair.first));
+      LuaType<bool>().push(state, e.type == sf::Event::KeyPressed);
+      get_player()->call_pushed(Script::HOOK_KEY, 2);
     }
   }
 
@@ -936,6 +1386,25 @@ void GameStage::update()
 
   // Recalculate lighting.
   _lighting->recalculate_traces(_camera.get_min(), _camera.get_max());
+
+  // Collect garbage in whatever time is left in the frame. The frame time
+  // average includes collection, so add the average collection time back on.
+  // When several updates run before the next draw, they share the frame's
+  // spare time between them.
+  static const std::size_t min_gc_budget_us = 100;
+  static const std::size_t max_gc_budget_us = 4000;
+  static const std::size_t default_gc_budget_us = 1000;
+  std::size_t gc_budget_us = default_gc_budget_us;
+  if (_run_timing && _run_timing->target_updates_per_second > 0.f) {
+    std::size_t frame_us =
+        std::size_t(1000000.f / _run_timing->target_updates_per_second);
+    std::size_t used_us = _run_timing->us_per_frame_avg - std::min(
+        _run_timing->us_per_frame_avg, _lua.get_gc_stats().ns_avg / 1000);
+    gc_budget_us = frame_us > used_us ? frame_us - used_us : 0;
+    gc_budget_us /= std::max(std::size_t(1), _run_timing->updates_this_cycle);
+  }
+  _lua.collect_garbage(std::max(
+      min_gc_budget_us, std::min(max_gc_budget_us, gc_budget_us)));
 }
 
 void GameStage::draw() const
@@ -944,6 +1413,11 @@ void GameStage::draw() const
                    *_lighting, *_collision, *_environment);
 }
 
+void GameStage::set_run_timing(const RunTiming& run_timing)
+{
+  _run_timing = &run_timing;
+}
+
 void GameStage::set_player(Script* player)
 {
   _player = player;
@@ -1,6 +1,7 @@
 #ifndef GAME_STAGE_H
 #define GAME_STAGE_H
 
+#include "environment.h"
 #include "world.h"
 #include "../render/util.h"
 #include "../lua.h"
@@ -8,6 +9,8 @@
 #include "../spatial_hash.h"
 #include "../vec.h"
 
+#include <deque>
+#include <functional>
 #include <list>
 #include <vector>
 #include <SFML/Audio.hpp>
@@ -16,12 +19,12 @@
 class Camera;
 class CellMap;
 class Collision;
-class Environment;
 class Filesystem;
 class Lighting;
 class RenderUtil;
 class Savegame;
 struct LuaFile;
+struct Sprite;
 
 // Stores all the scripts currently active.
 class ScriptBank {
@@ -46,16 +49,32 @@ public:
   void get_in_radius(result& output,
                      const y::wvec2& origin, y::world radius) const;
 
-  // Lua userdata can't be hashed, and since we make a new userdata each time
-  // we give a Script to Lua we need a way of indexing tables. Even if we gave
-  // the same userdata it would have to be modulo the calling Script; this
-  // ensures different Scripts can be uniquely identified across different
-  // client Scripts.
+  // Scripts can be used directly as table keys, since each Script is always
+  // given to Lua as the same proxy userdata. UIDs are small integers which
+  // uniquely identify live Scripts, for when a plain number is needed.
   std::int32_t get_uid(const Script* script) const;
 
-  // Stash a message for calling at the end of the frame.
-  void send_message(Script* script, const std::string& function_name,
-                    const std::vector<LuaValue>& args);
+  // Stash a message for calling at the end of the frame. The arguments are
+  // copied from the stack straight away. Messages sent while handling
+  // messages are called at the end of the next frame, and messages to a
+  // Script which is destroyed first are dropped.
+  void send_message(Script* script, const char* function_name,
+                    const LuaStackArgs& args);
+
+  // Scripts can define update_parallel, which runs before update against a
+  // frozen world. While it runs, every API call which changes the game state
+  // is deferred and applied afterwards in script order, so no update_parallel
+  // function sees the effects of another. Calls which need an immediate result
+  // (creating scripts, bodies, lights or constraints, collider_move_detail and
+  // collider_rotate) log an error and return nothing there, and collider_move
+  // returns a zero vector, so movement results can't be observed.
+  bool is_deferring() const;
+  template<typename F>
+  void run_or_defer(const F& command);
+  // As above, for a command on an object in the given ScriptMap. A deferred
+  // command is skipped if an earlier one destroyed the object.
+  template<typename T, typename F>
+  void run_or_defer(const ScriptMap<T>& map, T* obj, const F& command);
 
   // Functions below here should only be called by GameStage or GameRenderer,
   // not from the Lua API.
@@ -65,7 +84,7 @@ public:
   void update_spatial_hash(Script* source);
 
   // Functions for updating/rendering all the Scripts.
-  void update_all() const;
+  void update_all();
   void handle_messages();
   void move_all(const y::wvec2& move, Collision& collision);
   void render_all(const Camera& camera) const;
@@ -86,6 +105,18 @@ private:
 
   void add_script(std::unique_ptr<Script> script);
   void release_uid(Script* script);
+  void drop_messages(Script* script);
+
+  // Find or add the interned message function with the given name.
+  std::size_t intern_message_function(const char* name);
+  // Append a copy of the value at the given index to the message arena. A
+  // table which contains itself is stored as nil where it recurs.
+  void store_message_value(lua_State* state, lua_int index);
+  // Push the value at the given position in the message arena, and return the
+  // position after it.
+  struct message_queue;
+  std::size_t push_message_value(lua_State* state, const message_queue& queue,
+                                 std::size_t index) const;
 
   GameStage& _stage;
 
@@ -110,12 +141,67 @@ private:
   mutable std::unordered_map<const Script*, std::size_t> _uid_map;
   mutable std::set<std::size_t> _uid_unused;
 
+  // Message function names are interned on first use. Names of hooks are
+  // resolved up front, so those messages go through the cached references.
+  struct message_function {
+    std::string name;
+    Script::hook hook;
+  };
+  struct c_str_hash {
+    std::size_t operator()(const char* s) const;
+  };
+  struct c_str_equal {
+    bool operator()(const char* a, const char* b) const;
+  };
+  std::deque<message_function> _message_functions;
+  std::unordered_map<const char*, std::size_t,
+                     c_str_hash, c_str_equal> _message_function_ids;
+
+  // Message arguments are stored flat in a per-frame arena. Arrays are
+  // followed by their elements; strings refer to a separate character arena.
+  // Anything else (userdata) falls back to a LuaValue. The arenas keep their
+  // capacity between frames, so queueing messages doesn't usually allocate.
+  struct message_value {
+    enum {
+      NIL,
+      WORLD,
+      BOOLEAN,
+      STRING,
+      VEC,
+      ARRAY,
+      OTHER,
+    } type;
+    // Length of a string; number of elements of an array.
+    std::uint32_t size;
+    union {
+      y::world world;
+      bool boolean;
+      // Index into the character arena, or the fallback values.
+      std::size_t offset;
+      y::world vec[2];
+    };
+  };
   struct message {
     Script* script;
-    std::string function_name;
-    std::vector<LuaValue> args;
+    std::size_t function;
+    std::size_t args;
+    lua_int arg_count;
+  };
+  struct message_queue {
+    std::vector<message> messages;
+    std::vector<message_value> values;
+    std::vector<char> chars;
+    std::vector<LuaValue> others;
   };
-  std::vector<message> _messages;
+  // Messages are sent to one queue while the other is being handled, so
+  // scripts which answer each other's messages take one hop per frame.
+  message_queue _message_queues[2];
+  std::size_t _message_queue;
+  // Tables currently being stored, outermost first.
+  std::vector<const void*> _message_tables;
+
+  bool _deferring;
+  std::vector<std::function<void()>> _commands;
 
   // Temporary per-frame data for storing which cells we need to preserve.
   bool _all_cells_preserved;
@@ -163,6 +249,16 @@ public:
     DRAW_LAYER_MAX,
   };
 
+  // Resolution of the lightbuffer as a divisor of the framebuffer resolution.
+  // Light fall-off is smooth, so lower resolutions save a lot of fill-rate for
+  // slightly softer shadow edges. Edges between surfaces are kept sharp when
+  // upsampling by comparing against the normalbuffer.
+  enum light_quality {
+    LIGHT_QUALITY_FULL = 1,
+    LIGHT_QUALITY_HALF = 2,
+    LIGHT_QUALITY_QUARTER = 4,
+  };
+
   GameRenderer(RenderUtil& util, const GlFramebuffer& framebuffer);
   GameRenderer(const GameRenderer&) = delete;
   GameRenderer& operator=(const GameRenderer&) = delete;
@@ -170,6 +266,33 @@ public:
   RenderUtil& get_util() const;
   const GlFramebuffer& get_framebuffer() const;
 
+  // Changing the light quality recreates the lightbuffer. Unknown values
+  // mean full quality.
+  void set_light_quality(light_quality quality);
+  light_quality get_light_quality() const;
+
+  // When enabled (the default), each script's draw function is called once per
+  // frame and its draw calls recorded by layer, then replayed in every pass of
+  // that layer. Layers with nothing to draw are then skipped entirely. When
+  // disabled, scripts are drawn again in every pass.
+  void set_record_draw_calls(bool record);
+  bool get_record_draw_calls() const;
+
+  // Draw calls made by scripts. These are either recorded, or drawn right away
+  // if the current pass is part of the layer.
+  void render_sprite(
+      std::int32_t layer, const Sprite& sprite, const y::ivec2& frame_size,
+      const y::fvec2& origin, const y::ivec2& frame,
+      float depth, float rotation, const y::fvec4& colour) const;
+  void render_fog(
+      const Environment& environment, std::int32_t layer,
+      const y::wvec2& origin, const y::wvec2& region,
+      const Environment::fog_params& params) const;
+  void render_reflect(
+      const Environment& environment, std::int32_t layer,
+      const y::wvec2& origin, const y::wvec2& region,
+      const Environment::reflect_params& params) const;
+
   // Batches up all the sprites for a particular draw pass and renders them all
   // at once when the pass is done.
   RenderBatch& get_current_batch() const;
@@ -240,6 +363,69 @@ private:
   // Determines the lighting algorithm used for the current pass.
   layer_light_type draw_pass_light_type() const;
 
+  // Determines the layer the current pass is part of.
+  draw_layer draw_pass_layer() const;
+
+  // Recorded script draw calls. Each layer has a list of commands, which index
+  // into the list of parameters for that type of command.
+  enum draw_command_type {
+    DRAW_COMMAND_SPRITE,
+    DRAW_COMMAND_FOG,
+    DRAW_COMMAND_REFLECT,
+  };
+  struct draw_command {
+    draw_command_type type;
+    std::size_t index;
+  };
+  struct sprite_command {
+    const Sprite* sprite;
+    y::ivec2 frame_size;
+    y::fvec2 origin;
+    y::ivec2 frame;
+    float depth;
+    float rotation;
+    y::fvec4 colour;
+  };
+  struct fog_command {
+    y::wvec2 origin;
+    y::wvec2 region;
+    Environment::fog_params params;
+  };
+  struct reflect_command {
+    y::wvec2 origin;
+    y::wvec2 region;
+    Environment::reflect_params params;
+  };
+  typedef std::vector<draw_command> draw_list;
+
+  // Returns the draw list for a layer if draw calls are being recorded and the
+  // layer is valid, otherwise null.
+  draw_list* get_recording_list(std::int32_t layer) const;
+  // Draw calls for the current pass.
+  void draw_sprite(const sprite_command& command) const;
+  void draw_fog(const Environment& environment,
+                const fog_command& command) const;
+  void draw_reflect(const Environment& environment,
+                    const reflect_command& command) const;
+  // Replay the recorded draw calls for the current pass.
+  void replay_draw_list(const Environment& environment) const;
+
+  // The tiles of a cell, uploaded once and drawn from the same buffers every
+  // frame until the cell changes. Tiles on every layer share a buffer per
+  // texture (usually an atlas page), since the depth of each layer is stored
+  // per-vertex anyway.
+  struct tile_cache : Cell::render_cache {
+    struct entry {
+      GlTexture2D texture;
+      GlTexture2D normal;
+      std::unique_ptr<BatchBuffer> buffer;
+    };
+    std::vector<entry> entries;
+  };
+
+  // Get the tile cache for a cell, building it first if necessary.
+  const tile_cache& get_tile_cache(const Cell& cell) const;
+
   // Render all the tiles in the world. Used in the DRAW_WORLD layer.
   void render_tiles(
       const Camera& camera, const WorldWindow& world) const;
@@ -253,6 +439,7 @@ private:
   GlUnique<GlFramebuffer> _colourbuffer;
   GlUnique<GlFramebuffer> _normalbuffer;
   GlUnique<GlFramebuffer> _lightbuffer;
+  light_quality _light_quality;
 
   GlUnique<GlProgram> _scene_program;
   GlUnique<GlProgram> _scene_specular_program;
@@ -260,6 +447,13 @@ private:
   mutable draw_pass _current_draw_pass;
   mutable bool _current_draw_any;
 
+  bool _record_draw_calls;
+  mutable bool _recording_draw_calls;
+  mutable draw_list _draw_lists[DRAW_LAYER_MAX];
+  mutable std::vector<sprite_command> _sprite_commands;
+  mutable std::vector<fog_command> _fog_commands;
+  mutable std::vector<reflect_command> _reflect_commands;
+
 };
 
 class GameAudio {
@@ -323,6 +517,9 @@ public:
   const Savegame& get_savegame() const;
   /***/ Savegame& get_savegame();
 
+  const LuaVm& get_lua() const;
+  /***/ LuaVm& get_lua();
+
   const ScriptBank& get_scripts() const;
   /***/ ScriptBank& get_scripts();
 
@@ -355,6 +552,10 @@ public:
   void update() override;
   void draw() const override;
 
+  // Frame timings, used to decide how much time is left over for garbage
+  // collection at the end of each update.
+  void set_run_timing(const RunTiming& run_timing);
+
   // Lua API functions.
   void set_player(Script* script);
   Script* get_player() const;
@@ -374,6 +575,8 @@ private:
   std::string _active_source_key;
   WorldWindow _world;
 
+  // Must outlive the Scripts that run in it.
+  LuaVm _lua;
   ScriptBank _scripts;
   GameRenderer _renderer;
   GameAudio _audio;
@@ -385,10 +588,40 @@ private:
   std::unique_ptr<Environment> _environment;
 
   Script* _player;
+  const RunTiming* _run_timing;
 
   typedef std::unordered_map<std::int32_t, std::unordered_set<std::int32_t>> key_map;
   key_map _key_map;
 
 };
 
+template<typename F>
+void ScriptBank::run_or_defer(const F& command)
+{
+  if (_deferring) {
+    _commands.emplace_back(command);
+  }
+  else {
+    command();
+  }
+}
+
+template<typename T, typename F>
+void ScriptBank::run_or_defer(
+    const ScriptMap<T>& map, T* obj, const F& command)
+{
+  if (!_deferring) {
+    command();
+    return;
+  }
+  // The source is looked up now, while the object is known to exist.
+  const Script* source = &obj->source;
+  _commands.emplace_back([&map, obj, source, command]()
+  {
+    if (map.contains(*source, obj)) {
+      command();
+    }
+  });
+}
+
 #endif
@@ -1,4 +1,7 @@
 #include "lua.h"
+#include "log.h"
+#include <chrono>
+#include <cstring>
 
 namespace {
   // Variadic push.
@@ -47,8 +50,235 @@ namespace {
 #endif
   }
 
+  // Chunk reader and writer functions.
+  struct read_data {
+    const std::string& data;
+    bool has_read;
+  };
+
+  const char* read_chunk(lua_State*, void* data, std::size_t* size)
+  {
+    read_data* data_struct = reinterpret_cast<read_data*>(data);
+    if (data_struct->has_read) {
+      *size = 0;
+      return nullptr;
+    }
+    data_struct->has_read = true;
+    *size = data_struct->data.length();
+    return data_struct->data.c_str();
+  }
+
+  lua_int write_chunk(lua_State*, const void* chunk, std::size_t size,
+                      void* data)
+  {
+    reinterpret_cast<std::string*>(data)->append(
+        reinterpret_cast<const char*>(chunk), size);
+    return 0;
+  }
+
   struct RegistryIndex {};
   static RegistryIndex stage_registry_index;
+  static RegistryIndex script_proxy_index;
+
+  // Lua definition of the vector type. Metamethods are written in Lua so that
+  // the JIT can compile (and usually eliminate) the temporary vectors created
+  // by arithmetic. Returns the constructor.
+  const char* const vec_source = R"lua(
+local ffi = require("ffi")
+ffi.cdef("typedef struct {double _x, _y;} y_vec;")
+local sqrt, acos, fmod = math.sqrt, math.acos, math.fmod
+local abs, min, max = math.abs, math.min, math.max
+local vec_t
+
+local methods = {}
+
+function methods.x(v)
+  return v._x
+end
+
+function methods.y(v)
+  return v._y
+end
+
+function methods.dot(a, b)
+  return a._x * b._x + a._y * b._y
+end
+
+function methods.length_squared(v)
+  return v._x * v._x + v._y * v._y
+end
+
+function methods.length(v)
+  return sqrt(v._x * v._x + v._y * v._y)
+end
+
+function methods.normalised(v)
+  local l = sqrt(v._x * v._x + v._y * v._y)
+  return vec_t(v._x / l, v._y / l)
+end
+
+function methods.normalise(v)
+  local l = sqrt(v._x * v._x + v._y * v._y)
+  v._x, v._y = v._x / l, v._y / l
+end
+
+function methods.angle(a, b)
+  local l = methods.length(a) * methods.length(b)
+  if l == 0 then
+    return acos(0)
+  end
+  return acos(methods.dot(a, b) / l)
+end
+
+function methods.in_region(v, origin, size)
+  local x, y = origin._x - size._x / 2, origin._y - size._y / 2
+  return v._x >= x and v._x < x + size._x and
+      v._y >= y and v._y < y + size._y
+end
+
+function methods.abs(v)
+  return vec_t(abs(v._x), abs(v._y))
+end
+
+function methods.max(a, b)
+  return vec_t(max(a._x, b._x), max(a._y, b._y))
+end
+
+function methods.min(a, b)
+  return vec_t(min(a._x, b._x), min(a._y, b._y))
+end
+
+local mt = {__index = methods}
+
+function mt.__add(a, b)
+  return vec_t(a._x + b._x, a._y + b._y)
+end
+
+function mt.__sub(a, b)
+  return vec_t(a._x - b._x, a._y - b._y)
+end
+
+function mt.__mul(a, b)
+  if type(a) == "number" then
+    return vec_t(a * b._x, a * b._y)
+  elseif type(b) == "number" then
+    return vec_t(a._x * b, a._y * b)
+  end
+  return vec_t(a._x * b._x, a._y * b._y)
+end
+
+function mt.__div(a, b)
+  if type(a) == "number" then
+    return vec_t(a / b._x, a / b._y)
+  elseif type(b) == "number" then
+    return vec_t(a._x / b, a._y / b)
+  end
+  return vec_t(a._x / b._x, a._y / b._y)
+end
+
+function mt.__mod(a, b)
+  return vec_t(fmod(a._x, b._x), fmod(a._y, b._y))
+end
+
+function mt.__unm(v)
+  return vec_t(-v._x, -v._y)
+end
+
+-- Called when comparing a vector to anything, not just another vector.
+function mt.__eq(a, b)
+  return ffi.istype(vec_t, a) and ffi.istype(vec_t, b) and
+      a._x == b._x and a._y == b._y
+end
+
+function mt.__tostring(v)
+  return "vec(" .. v._x .. ", " .. v._y .. ")"
+end
+
+vec_t = ffi.metatype("y_vec", mt)
+vec = vec_t
+return vec_t
+)lua";
+
+  // Define the vector type and store its constructor in the registry.
+  void define_vec(lua_State* state)
+  {
+    typedef LuaType<y::wvec2> vec_type;
+    lua_pushlightuserdata(state, &vec_type::constructor_key);
+    if (luaL_loadbuffer(state, vec_source, std::strlen(vec_source), "=vec") ||
+        lua_pcall(state, 0, 1, 0)) {
+      log_err("Defining vector type failed: ", lua_tostring(state, -1));
+      lua_pop(state, 2);
+      return;
+    }
+
+    // Construct a vector to find out the struct's type ID.
+    lua_pushvalue(state, -1);
+    if (lua_pcall(state, 0, 1, 0) ||
+        lua_type(state, -1) != vec_type::cdata_type) {
+      log_err("Constructing a vector failed");
+      lua_pop(state, 3);
+      return;
+    }
+    vec_type::ctype_id = (reinterpret_cast<const vec_type::cdata_header*>(
+        lua_topointer(state, -1)) - 1)->ctype_id;
+    lua_pop(state, 1);
+    lua_rawset(state, LUA_REGISTRYINDEX);
+
+    // Vectors can be stored in LuaValues like any userdata.
+    if (lua_generic_type_map.find(vec_type::type_name) ==
+        lua_generic_type_map.end()) {
+      lua_generic_type_map.emplace(
+          vec_type::type_name,
+          std::unique_ptr<LuaGenericType>(new vec_type()));
+    }
+  }
+
+  // Must be kept consistent with Script::hook.
+  const std::string hook_names[] = {
+    "update",
+    "update_parallel",
+    "draw",
+    "key",
+    "on_submerge",
+    "on_emerge",
+  };
+  static_assert(sizeof(hook_names) / sizeof(hook_names[0]) ==
+                Script::HOOK_COUNT, "hook names don't match");
+
+  // Push the cached proxy for a Script, creating it if there isn't one.
+  void push_script_proxy(lua_State* state, const Script* script,
+                         const std::string& type_name)
+  {
+    void* key = const_cast<Script*>(script);
+    lua_pushlightuserdata(state, reinterpret_cast<void*>(&script_proxy_index));
+    lua_rawget(state, LUA_REGISTRYINDEX);
+    lua_pushlightuserdata(state, key);
+    lua_rawget(state, -2);
+    if (lua_isnil(state, -1)) {
+      lua_pop(state, 1);
+      const Script** proxy = reinterpret_cast<const Script**>(
+          lua_newuserdata(state, sizeof(Script*)));
+      *proxy = script;
+      luaL_getmetatable(state, type_name.c_str());
+      lua_setmetatable(state, -2);
+      lua_pushlightuserdata(state, key);
+      lua_pushvalue(state, -2);
+      lua_rawset(state, -4);
+    }
+    lua_remove(state, -2);
+  }
+
+  // Find the hook with the given name, returning HOOK_COUNT if there isn't
+  // one.
+  Script::hook find_hook(const char* name)
+  {
+    for (std::size_t i = 0; i < Script::HOOK_COUNT; ++i) {
+      if (hook_names[i] == name) {
+        return Script::hook(i);
+      }
+    }
+    return Script::HOOK_COUNT;
+  }
 }
 
 /******************************************************************************/
@@ -123,6 +353,7 @@ namespace {
 /***/     lua_gettable(_y_state, LUA_REGISTRYINDEX);                           \
 /***/     GameStage& stage = *lua_get<GameStage*>(_y_state, -1);               \
 /***/     lua_pop(_y_state, 1);                                                \
+/***/     LuaProfiler::api_scope _y_profile(stage.get_lua().get_profiler());   \
 /***/     (void)stage;
 /***/
 /***/ #define y_arg(T, name)                                                   \
@@ -146,6 +377,14 @@ namespace {
 /***/ #define y_assert(condition, index, message)                              \
 /***/     lua_argassert((_y_state), (condition), (index), (message))
 /***/
+/***/ #define y_check(condition, message)                                      \
+/***/     do {                                                                 \
+/***/       if (!(condition)) {                                                \
+/***/         log_err(message);                                                \
+/***/         return 0;                                                        \
+/***/       }                                                                  \
+/***/     } while (false)
+/***/
 /***/ #define y_return(...)                                                    \
 /***/       return push_all(_y_state, __VA_ARGS__);                            \
 /***/     }                                                                    \
@@ -171,6 +410,7 @@ namespace {
 /***/ #undef y_varargs
 /***/ #undef y_optarg
 /***/ #undef y_assert
+/***/ #undef y_check
 /***/ #undef y_return
 /***/ #undef y_void
 /***/
@@ -228,6 +468,8 @@ namespace {
 /***/
 /***/ #define y_assert(condition, index, message)
 /***/
+/***/ #define y_check(condition, message)
+/***/
 /***/ #define y_return(...)                                                    \
 /***/         push_all(0, __VA_ARGS__);                                        \
 /***/       }                                                                  \
@@ -257,6 +499,7 @@ namespace {
 /***/ #undef y_varargs
 /***/ #undef y_optarg
 /***/ #undef y_assert
+/***/ #undef y_check
 /***/ #undef y_return
 /***/ #undef y_void
 /******************************************************************************/
@@ -443,44 +686,70 @@ const Script* ConstScriptReference::operator->() const
   return _script;
 }
 
-Script::Script(GameStage& stage,
-               const std::string& path, const std::string& contents,
-               const y::wvec2& origin, const y::wvec2& region)
-  : _path(path)
+bool compile_script(std::string& output,
+                    const std::string& path, const std::string& contents)
+{
+  output.clear();
+  // Only the parser is needed, so the state doesn't need any libraries.
+  lua_State* state = luaL_newstate();
+  read_data data_struct{contents, false};
+  bool compiled = !lua_load(state, read_chunk, &data_struct, path.c_str()) &&
+      !lua_dump(state, write_chunk, &output);
+  if (!compiled) {
+    const char* error = lua_tostring(state, -1);
+    logg_err("Compiling script ", path, " failed");
+    if (error) {
+      logg_err(": ", error);
+    }
+    log_err();
+    output.clear();
+  }
+  lua_close(state);
+  return compiled;
+}
+
+template<>
+void LuaType<Script*>::push(lua_State* state, Script* const& arg) const
+{
+  push_script_proxy(state, arg, type_name);
+}
+
+template<>
+void LuaType<const Script*>::push(
+    lua_State* state, const Script* const& arg) const
+{
+  push_script_proxy(state, arg, type_name);
+}
+
+LuaVm::LuaVm(GameStage& stage)
   // Use standard allocator and panic function.
-  , _state(luaL_newstate())
-  , _origin(origin)
-  , _region(region)
-  , _rotation(0.)
-  , _destroyed(false)
+  : _state(luaL_newstate())
+  , _traceback(LUA_NOREF)
+  , _globals_view_metatable(LUA_NOREF)
+  , _gc_cycle_memory(0)
 {
   // Load the Lua standard library.
   luaL_openlibs(_state);
   // Register Lua API.
   y_register(_state);
+  define_vec(_state);
 
-  // Chunk reader function.
-  struct read_data {
-    const std::string& data;
-    bool has_read;
-  };
-
-  auto read = [&](lua_State*, void* data, std::size_t* size)
-  {
-    read_data* data_struct = reinterpret_cast<read_data*>(data);
-    if (data_struct->has_read) {
-      *size = 0;
-      return (const char*)nullptr;
-    }
-    data_struct->has_read = true;
-    *size = data_struct->data.length();
-    return data_struct->data.c_str();
-  };
-
-  // Use traceback error handler (stored in stack at position 1 always).
+  // Use traceback error handler.
   lua_getglobal(_state, "debug");
-  lua_getfield(_state, 1, "traceback");
-  lua_remove(_state, 1);
+  lua_getfield(_state, -1, "traceback");
+  _traceback = luaL_ref(_state, LUA_REGISTRYINDEX);
+  lua_pop(_state, 1);
+
+  // Set Script proxy cache in the registry. It's weak-valued, so proxies are
+  // collected when Lua no longer refers to them.
+  lua_pushlightuserdata(
+      _state, reinterpret_cast<void*>(&script_proxy_index));
+  lua_newtable(_state);
+  lua_newtable(_state);
+  lua_pushstring(_state, "v");
+  lua_setfield(_state, -2, "__mode");
+  lua_setmetatable(_state, -2);
+  lua_settable(_state, LUA_REGISTRYINDEX);
 
   // Set GameStage reference in the registry.
   lua_pushlightuserdata(
@@ -488,31 +757,219 @@ Script::Script(GameStage& stage,
   push_all(_state, &stage);
   lua_settable(_state, LUA_REGISTRYINDEX);
 
-  // Set self-reference global variable.
-  push_all(_state, this);
-  lua_setglobal(_state, "self");
+  lua_newtable(_state);
+  lua_pushvalue(_state, LUA_GLOBALSINDEX);
+  lua_setfield(_state, -2, "__index");
+  _globals_view_metatable = luaL_ref(_state, LUA_REGISTRYINDEX);
+}
 
+LuaVm::~LuaVm()
+{
+  lua_close(_state);
+}
+
+LuaVm::gc_stats::gc_stats()
+  : budget_us(0)
+  , ns(0)
+  , steps(0)
+  , ns_avg(0)
+  , cycles(0)
+{
+}
+
+lua_State* LuaVm::get_state() const
+{
+  return _state;
+}
+
+void LuaVm::push_traceback() const
+{
+  lua_rawgeti(_state, LUA_REGISTRYINDEX, _traceback);
+}
+
+void LuaVm::push_globals_view() const
+{
+  lua_newtable(_state);
+  lua_rawgeti(_state, LUA_REGISTRYINDEX, _globals_view_metatable);
+  lua_setmetatable(_state, -2);
+}
+
+LuaProfiler& LuaVm::get_profiler()
+{
+  return _profiler;
+}
+
+const LuaProfiler& LuaVm::get_profiler() const
+{
+  return _profiler;
+}
+
+std::size_t LuaVm::get_memory() const
+{
+  return 1024 * std::size_t(lua_gc(_state, LUA_GCCOUNT, 0)) +
+      std::size_t(lua_gc(_state, LUA_GCCOUNTB, 0));
+}
+
+void LuaVm::set_automatic_gc(bool automatic)
+{
+  lua_gc(_state, automatic ? LUA_GCRESTART : LUA_GCSTOP, 0);
+  _gc_cycle_memory = get_memory();
+}
+
+void LuaVm::collect_garbage(std::size_t budget_us)
+{
+  typedef std::chrono::high_resolution_clock hrclock;
+  // Like Lua's default pause, let the heap double before insisting on a full
+  // cycle.
+  static const std::size_t heap_growth_limit = 2;
+  // Matches the number of measurements averaged by ModalStack.
+  static const std::size_t average_calls = 64;
+
+  hrclock::time_point start = hrclock::now();
+  std::chrono::microseconds budget(budget_us);
+  bool finish_cycle = get_memory() > heap_growth_limit * _gc_cycle_memory;
+  _gc_stats.budget_us = budget_us;
+  _gc_stats.steps = 0;
+
+  // Each step does a small, fixed amount of work, so checking the clock in
+  // between keeps close to the budget.
+  while (true) {
+    ++_gc_stats.steps;
+    if (lua_gc(_state, LUA_GCSTEP, 0)) {
+      ++_gc_stats.cycles;
+      _gc_cycle_memory = get_memory();
+      break;
+    }
+    if (!finish_cycle && hrclock::now() - start >= budget) {
+      break;
+    }
+  }
+
+  // Stepping lowers the allocation threshold, which would let allocation
+  // trigger collection again.
+  lua_gc(_state, LUA_GCSTOP, 0);
+  _gc_stats.ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      hrclock::now() - start).count();
+  _gc_stats.ns_avg =
+      (_gc_stats.ns + (average_calls - 1) * _gc_stats.ns_avg) / average_calls;
+}
+
+const LuaVm::gc_stats& LuaVm::get_gc_stats() const
+{
+  return _gc_stats;
+}
+
+Script::Script(LuaVm& vm,
+               const std::string& path, const std::string& contents,
+               const y::wvec2& origin, const y::wvec2& region)
+  : _path(path)
+  , _vm(vm)
+  , _environment(LUA_NOREF)
+  , _origin(origin)
+  , _region(region)
+  , _rotation(0.)
+  , _destroyed(false)
+{
+  load(contents);
+}
+
+Script::Script(GameStage& stage,
+               const std::string& path, const std::string& contents,
+               const y::wvec2& origin, const y::wvec2& region)
+  : _path(path)
+  , _own_vm(new LuaVm(stage))
+  , _vm(*_own_vm)
+  , _environment(LUA_NOREF)
+  , _origin(origin)
+  , _region(region)
+  , _rotation(0.)
+  , _destroyed(false)
+{
+  load(contents);
+}
+
+Script::~Script()
+{
+  destroy();
+  lua_State* state = _vm.get_state();
+  for (lua_int ref : _hooks) {
+    luaL_unref(state, LUA_REGISTRYINDEX, ref);
+  }
+
+  // The environment is collected along with everything else the Script made,
+  // once nothing refers to it. Until then, it mustn't refer back to us.
+  lua_rawgeti(state, LUA_REGISTRYINDEX, _environment);
+  lua_getmetatable(state, -1);
+  lua_getfield(state, -1, "__newindex");
+  lua_pushnil(state);
+  lua_setupvalue(state, -2, 2);
+  lua_pop(state, 3);
+  luaL_unref(state, LUA_REGISTRYINDEX, _environment);
+
+  // Forget our proxy, so that a new Script at the same address gets its own.
+  lua_pushlightuserdata(state, reinterpret_cast<void*>(&script_proxy_index));
+  lua_rawget(state, LUA_REGISTRYINDEX);
+  lua_pushlightuserdata(state, this);
+  lua_pushnil(state);
+  lua_rawset(state, -3);
+  lua_pop(state, 1);
+}
+
+void Script::load(const std::string& contents)
+{
+  lua_State* state = _vm.get_state();
+  for (lua_int& ref : _hooks) {
+    ref = LUA_NOREF;
+  }
+
+  // Globals are private to the environment, and reads fall through to the
+  // shared globals. Hooks live in a table in-between, so assigning one always
+  // goes through __newindex, which keeps the references up-to-date.
+  _vm.push_globals_view();
+  lua_newtable(state);
+  lua_newtable(state);
+  lua_pushvalue(state, -3);
+  lua_setfield(state, -2, "__index");
+  lua_pushvalue(state, -3);
+  lua_pushlightuserdata(state, this);
+  lua_pushcclosure(state, &Script::set_global, 2);
+  lua_setfield(state, -2, "__newindex");
+  lua_setmetatable(state, -2);
+  lua_remove(state, -2);
+
+  // Set self-reference variable in the environment.
+  push_all(state, this);
+  lua_setfield(state, -2, "self");
+  _environment = luaL_ref(state, LUA_REGISTRYINDEX);
+
+  lua_int top = lua_gettop(state);
+  _vm.push_traceback();
   read_data data_struct{contents, false};
-  if (lua_load(_state, read, &data_struct, _path.c_str()) ||
-      lua_pcall(_state, 0, 0, 1)) {
-    const char* error = lua_tostring(_state, -1);
+  bool failed = lua_load(state, read_chunk, &data_struct, _path.c_str()) != 0;
+  if (!failed) {
+    lua_rawgeti(state, LUA_REGISTRYINDEX, _environment);
+    lua_setfenv(state, -2);
+    failed = lua_pcall(state, 0, 0, 1 + top) != 0;
+  }
+  if (failed) {
+    const char* error = lua_tostring(state, -1);
     logg_err("Loading script ", _path, " failed");
     if (error) {
       logg_err(": ", error);
     }
     log_err();
   }
+  lua_settop(state, top);
 }
 
-Script::~Script()
+const std::string& Script::get_path() const
 {
-  destroy();
-  lua_close(_state);
+  return _path;
 }
 
-const std::string& Script::get_path() const
+const LuaVm& Script::get_vm() const
 {
-  return _path;
+  return _vm;
 }
 
 const y::wvec2& Script::get_region() const
@@ -547,40 +1004,184 @@ void Script::set_rotation(y::world rotation)
   _move_callbacks(this);
 }
 
+Script::hook Script::get_hook(const char* name)
+{
+  return find_hook(name);
+}
+
+bool Script::has_function(hook function) const
+{
+  return _hooks[function] != LUA_NOREF;
+}
+
 bool Script::has_function(const std::string& function_name) const
 {
-  lua_getglobal(_state, function_name.c_str());
-  bool has = lua_isfunction(_state, -1);
-  lua_pop(_state, 1);
+  lua_State* state = _vm.get_state();
+  push_function(function_name);
+  bool has = lua_isfunction(state, -1);
+  lua_pop(state, 1);
   return has;
 }
 
+void Script::call(hook function)
+{
+  if (_hooks[function] == LUA_NOREF) {
+    return;
+  }
+  lua_State* state = _vm.get_state();
+  LuaProfiler::call_scope profile(
+      _vm.get_profiler(), state, _path, hook_names[function]);
+  lua_int top = lua_gettop(state);
+  _vm.push_traceback();
+  lua_rawgeti(state, LUA_REGISTRYINDEX, _hooks[function]);
+  if (lua_pcall(state, 0, 0, 1 + top)) {
+    const char* error = lua_tostring(state, -1);
+    logg_err("Calling function ", _path, ":", hook_names[function], " failed");
+    if (error) {
+      logg_err(": ", error);
+    }
+    log_err();
+  }
+  lua_settop(state, top);
+}
+
 void Script::call(const std::string& function_name, const lua_args& args)
 {
-  lua_args output;
-  call(output, function_name, args);
+  // The results aren't needed, so don't convert them. Unlike call_pushed(), a
+  // missing function is an error.
+  lua_State* state = _vm.get_state();
+  LuaType<LuaValue> t;
+  for (const LuaValue& arg : args) {
+    t.push(state, arg);
+  }
+  push_function(function_name);
+  if (!lua_isfunction(state, -1)) {
+    log_err("Calling function ", _path, ":", function_name,
+            " failed: attempt to call a ",
+            lua_typename(state, lua_type(state, -1)), " value");
+    lua_pop(state, 1 + args.size());
+    return;
+  }
+  call_pushed_function(function_name, args.size());
 }
 
 void Script::call(lua_args& output, const std::string& function_name,
                   const lua_args& args)
 {
-  lua_int top = lua_gettop(_state);
-  lua_getglobal(_state, function_name.c_str());
+  // Calls can nest (for example, a Lua API function may call back into
+  // another Script), so everything is relative to the current top.
+  lua_State* state = _vm.get_state();
+  LuaProfiler::call_scope profile(
+      _vm.get_profiler(), state, _path, function_name);
+  lua_int top = lua_gettop(state);
+  _vm.push_traceback();
+  push_function(function_name);
   LuaType<LuaValue> t;
   for (const LuaValue& arg : args) {
-    t.push(_state, arg);
+    t.push(state, arg);
+  }
+  if (lua_pcall(state, args.size(), LUA_MULTRET, 1 + top)) {
+    const char* error = lua_tostring(state, -1);
+    logg_err("Calling function ", _path, ":", function_name, " failed");
+    if (error) {
+      logg_err(": ", error);
+    }
+    log_err();
+    lua_settop(state, top);
+    return;
+  }
+  for (lua_int i = 2 + top; i <= lua_gettop(state); ++i) {
+    output.emplace_back(t.get(state, i));
+  }
+  lua_settop(state, top);
+}
+
+void Script::call_pushed(hook function, lua_int pushed_args)
+{
+  lua_State* state = _vm.get_state();
+  if (_hooks[function] == LUA_NOREF) {
+    lua_pop(state, pushed_args);
+    return;
   }
-  if (lua_pcall(_state, args.size(), LUA_MULTRET, 1)) {
-    const char* error = lua_tostring(_state, -1);
+  lua_rawgeti(state, LUA_REGISTRYINDEX, _hooks[function]);
+  call_pushed_function(hook_names[function], pushed_args);
+}
+
+void Script::call_pushed(const std::string& function_name, lua_int pushed_args)
+{
+  push_function(function_name);
+  call_pushed_function(function_name, pushed_args);
+}
+
+void Script::push_function(const std::string& function_name) const
+{
+  lua_State* state = _vm.get_state();
+  hook function = find_hook(function_name.c_str());
+  if (function != HOOK_COUNT) {
+    if (_hooks[function] == LUA_NOREF) {
+      lua_pushnil(state);
+    }
+    else {
+      lua_rawgeti(state, LUA_REGISTRYINDEX, _hooks[function]);
+    }
+    return;
+  }
+  lua_rawgeti(state, LUA_REGISTRYINDEX, _environment);
+  lua_getfield(state, -1, function_name.c_str());
+  lua_remove(state, -2);
+}
+
+void Script::call_pushed_function(const std::string& function_name,
+                                  lua_int pushed_args)
+{
+  lua_State* state = _vm.get_state();
+  lua_int top = lua_gettop(state) - pushed_args - 1;
+  if (!lua_isfunction(state, -1)) {
+    lua_settop(state, top);
+    return;
+  }
+  LuaProfiler::call_scope profile(
+      _vm.get_profiler(), state, _path, function_name);
+  lua_insert(state, 1 + top);
+  _vm.push_traceback();
+  lua_insert(state, 1 + top);
+  if (lua_pcall(state, pushed_args, 0, 1 + top)) {
+    const char* error = lua_tostring(state, -1);
     logg_err("Calling function ", _path, ":", function_name, " failed");
     if (error) {
       logg_err(": ", error);
     }
     log_err();
   }
-  for (++top; top <= lua_gettop(_state); ++top) {
-    output.emplace_back(t.get(_state, top));
+  lua_settop(state, top);
+}
+
+lua_int Script::set_global(lua_State* state)
+{
+  // Arguments are the environment, key and value. The upvalues are the hook
+  // table and the Script, which is cleared when the Script is destroyed.
+  Script* script = reinterpret_cast<Script*>(
+      lua_touserdata(state, lua_upvalueindex(2)));
+  hook function = lua_type(state, 2) == LUA_TSTRING ?
+      find_hook(lua_tostring(state, 2)) : HOOK_COUNT;
+  if (function == HOOK_COUNT) {
+    lua_rawset(state, 1);
+    return 0;
+  }
+
+  lua_pushvalue(state, 2);
+  lua_pushvalue(state, 3);
+  lua_rawset(state, lua_upvalueindex(1));
+  if (!script) {
+    return 0;
+  }
+  luaL_unref(state, LUA_REGISTRYINDEX, script->_hooks[function]);
+  script->_hooks[function] = LUA_NOREF;
+  if (lua_isfunction(state, 3)) {
+    lua_pushvalue(state, 3);
+    script->_hooks[function] = luaL_ref(state, LUA_REGISTRYINDEX);
   }
+  return 0;
 }
 
 std::int32_t Script::add_move_callback(const callback& c) const
@@ -3,6 +3,7 @@
 
 #include "callback.h"
 #include "vec.h"
+#include "lua_profiler.h"
 #include "lua_types.h"
 #include <unordered_map>
 
@@ -74,9 +75,81 @@ private:
 
 };
 
+// Compile a script to LuaJIT bytecode, which Scripts can load from much faster
+// than from the source. On failure, logs the error and leaves output empty.
+bool compile_script(std::string& output,
+                    const std::string& path, const std::string& contents);
+
+// A Lua state with the standard library and the Lua API loaded. A full state
+// costs a lot of memory and construction time, so normally all the Scripts in
+// a GameStage share one, each running in an environment table of its own.
+class LuaVm {
+public:
+
+  LuaVm(GameStage& stage);
+  ~LuaVm();
+
+  LuaVm(const LuaVm&) = delete;
+  LuaVm& operator=(const LuaVm&) = delete;
+
+  lua_State* get_state() const;
+
+  // Push the error handler to use for calls.
+  void push_traceback() const;
+  // Push a new, empty table which reads through to the shared globals.
+  void push_globals_view() const;
+
+  // Profile of calls to Scripts in this state.
+  /***/ LuaProfiler& get_profiler();
+  const LuaProfiler& get_profiler() const;
+
+  // Memory in use by the state, in bytes.
+  std::size_t get_memory() const;
+
+  struct gc_stats {
+    gc_stats();
+
+    // For the most recent call to collect_garbage().
+    std::size_t budget_us;
+    std::size_t ns;
+    std::size_t steps;
+    // Moving average of the time taken, over roughly the last 64 calls.
+    std::size_t ns_avg;
+    // Total number of complete collection cycles.
+    std::size_t cycles;
+  };
+
+  // By default, Lua collects garbage whenever allocation decides it should,
+  // which puts pauses in unpredictable frames. With automatic collection off,
+  // the owner must call collect_garbage() regularly instead.
+  void set_automatic_gc(bool automatic);
+  // Run the incremental collector for roughly the given time. If the heap has
+  // grown too far since the last complete cycle, the cycle is finished
+  // regardless of the budget, so that memory use stays bounded.
+  void collect_garbage(std::size_t budget_us);
+  const gc_stats& get_gc_stats() const;
+
+private:
+
+  lua_State* _state;
+  lua_int _traceback;
+  lua_int _globals_view_metatable;
+  LuaProfiler _profiler;
+
+  gc_stats _gc_stats;
+  std::size_t _gc_cycle_memory;
+
+};
+
 class Script {
 public:
 
+  // Run the Script in its own environment in a shared LuaVm, which must
+  // outlive the Script. The contents can be either source or bytecode from
+  // compile_script().
+  Script(LuaVm& vm, const std::string& path, const std::string& contents,
+         const y::wvec2& origin, const y::wvec2& region);
+  // Run the Script in a LuaVm of its own.
   Script(GameStage& stage, const std::string& path, const std::string& contents,
          const y::wvec2& origin, const y::wvec2& region);
   ~Script();
@@ -85,6 +158,7 @@ public:
   Script& operator=(const Script&) = delete;
 
   const std::string& get_path() const;
+  const LuaVm& get_vm() const;
 
   // A Script's region is initially provided on load from the CellMap (or when
   // dynamically created). The origin is always centered in the region. Scripts
@@ -99,10 +173,34 @@ public:
 
   typedef std::vector<LuaValue> lua_args;
 
+  // Functions the engine calls on Scripts. These are resolved into references
+  // when they're defined (or redefined), so checking for and calling them
+  // doesn't need to look anything up.
+  enum hook {
+    HOOK_UPDATE,
+    HOOK_UPDATE_PARALLEL,
+    HOOK_DRAW,
+    HOOK_KEY,
+    HOOK_ON_SUBMERGE,
+    HOOK_ON_EMERGE,
+    HOOK_COUNT,
+  };
+  // The hook with the given name, or HOOK_COUNT if there isn't one.
+  static hook get_hook(const char* name);
+
+  bool has_function(hook function) const;
   bool has_function(const std::string& function_name) const;
+  // Call a function with no arguments, ignoring any results. Doesn't allocate
+  // unless there's an error.
+  void call(hook function);
   void call(const std::string& function_name, const lua_args& args = {});
   void call(lua_args& output, const std::string& function_name,
             const lua_args& args = {});
+  // Call a function on arguments already pushed to the top of the stack of
+  // get_vm(), ignoring any results. The arguments are popped. Does nothing if
+  // there's no such function.
+  void call_pushed(hook function, lua_int pushed_args);
+  void call_pushed(const std::string& function_name, lua_int pushed_args);
 
   typedef CallbackSet<Script*>::callback callback;
   std::int32_t add_move_callback(const callback& callback) const;
@@ -115,8 +213,21 @@ public:
 
 private:
 
+  void load(const std::string& contents);
+  // Push the named function, using the cached reference if it's a hook.
+  void push_function(const std::string& function_name) const;
+  // Call the function on top of the stack on the arguments below it.
+  void call_pushed_function(const std::string& function_name,
+                            lua_int pushed_args);
+  // The environment's __newindex. Hooks are stored apart from the other
+  // globals, so that assigning one always comes through here.
+  static lua_int set_global(lua_State* state);
+
   std::string _path;
-  lua_State* _state;
+  std::unique_ptr<LuaVm> _own_vm;
+  LuaVm& _vm;
+  lua_int _environment;
+  lua_int _hooks[HOOK_COUNT];
 
   y::wvec2 _origin;
   y::wvec2 _region;
@@ -128,6 +239,15 @@ private:
 
 };
 
+// Scripts are given to Lua as a single proxy userdata per Lua state, which is
+// cached while anything refers to it. Proxies can be compared and used as
+// table keys, and fetching a Script again doesn't allocate.
+template<>
+void LuaType<Script*>::push(lua_State* state, Script* const& arg) const;
+template<>
+void LuaType<const Script*>::push(
+    lua_State* state, const Script* const& arg) const;
+
 // Associated objects with Scripts which are destroyed when the Script that
 // aossicated them is destroyed. T is the associated object type.
 template<typename T>
@@ -152,6 +272,9 @@ public:
 
   const entry_list& get_list(const Script& source) const;
   void get_sources(source_list& output) const;
+  // Whether the object still exists, without dereferencing it. Objects of
+  // destroyed Scripts exist until they are cleaned up.
+  bool contains(const Script& source, const T* obj) const;
 
 protected:
 
@@ -263,6 +386,21 @@ void ScriptMap<T>::get_sources(source_list& output) const
   }
 }
 
+template<typename T>
+bool ScriptMap<T>::contains(const Script& source, const T* obj) const
+{
+  auto it = _map.find(const_cast<Script*>(&source));
+  if (it == _map.end()) {
+    return false;
+  }
+  for (const entry& e : it->second.list) {
+    if (e.get() == obj) {
+      return true;
+    }
+  }
+  return false;
+}
+
 template<typename T>
 void ScriptMap<T>::on_create(const Script&, T*)
 {
@@ -21,159 +21,8 @@ y_ptrtypedef(SfMusic) {} y_endtypedef();
 /******************************************************************************/
 // Vector API
 /******************************************************************************/
-y_api(vec)
-    y_arg(y::world, x) y_arg(y::world, y)
-{
-  y_return(y::wvec2{x, y});
-}
-
-y_api(vec__add)
-    y_arg(const y::wvec2, a) y_arg(const y::wvec2, b)
-{
-  y_return(a + b);
-}
-
-y_api(vec__sub)
-    y_arg(const y::wvec2, a) y_arg(const y::wvec2, b)
-{
-  y_return(a - b);
-}
-
-y_api(vec__mul)
-    y_optarg(const y::wvec2, a_vec) y_optarg(y::world, scalar)
-    y_optarg(const y::wvec2, b_vec)
-{
-  static const std::string error =
-           LuaType<y::wvec2>::type_name + " or " +
-           LuaType<y::world>::type_name + " expected";
-  y_assert(a_vec_defined || b_vec_defined, 0, error);
-  y_assert(scalar_defined || (a_vec_defined && b_vec_defined), 1, error);
-
-  y_return((a_vec_defined ? a_vec : y::wvec2(scalar, scalar)) *
-           (b_vec_defined ? b_vec : y::wvec2(scalar, scalar)));
-}
-
-y_api(vec__div)
-    y_optarg(const y::wvec2, a_vec) y_optarg(y::world, scalar)
-    y_optarg(const y::wvec2, b_vec)
-{
-  static const std::string error =
-           LuaType<y::wvec2>::type_name + " or " +
-           LuaType<y::world>::type_name + " expected";
-  y_assert(a_vec_defined || b_vec_defined, 0, error);
-  y_assert(scalar_defined || (a_vec_defined && b_vec_defined), 1, error);
-
-  y_return((a_vec_defined ? a_vec : y::wvec2(scalar, scalar)) /
-           (b_vec_defined ? b_vec : y::wvec2(scalar, scalar)));
-}
-
-y_api(vec__mod)
-    y_arg(const y::wvec2, a) y_arg(const y::wvec2, b)
-{
-  y_return(y::wvec2{fmod(a[xx], b[xx]), fmod(a[yy], b[yy])});
-}
-
-y_api(vec__unm)
-    y_arg(const y::wvec2, v)
-{
-  y_return(-v);
-}
-
-y_api(vec__x)
-    y_arg(const y::wvec2, v)
-{
-  y_return(v[xx]);
-}
-
-y_api(vec__y)
-    y_arg(const y::wvec2, v)
-{
-  y_return(v[yy]);
-}
-
-y_api(vec__normalised)
-    y_arg(const y::wvec2, v)
-{
-  y_return(v.normalised());
-}
-
-y_api(vec__normalise)
-    y_arg(y::wvec2, v)
-{
-  v.normalise();
-  y_void();
-}
-
-y_api(vec__dot)
-    y_arg(const y::wvec2, a) y_arg(const y::wvec2, b)
-{
-  y_return(a.dot(b));
-}
-
-y_api(vec__length_squared)
-    y_arg(const y::wvec2, v)
-{
-  y_return(v.length_squared());
-}
-
-y_api(vec__length)
-    y_arg(const y::wvec2, v)
-{
-  y_return(v.length());
-}
-
-y_api(vec__angle)
-    y_arg(const y::wvec2, a) y_arg(const y::wvec2, b)
-{
-  y_return(y::angle(a, b));
-}
-
-y_api(vec__in_region)
-    y_arg(const y::wvec2, v)
-    y_arg(const y::wvec2, origin) y_arg(const y::wvec2, size)
-{
-  y_return(y::in_region(v, origin - size / 2, size));
-}
-
-y_api(vec__abs)
-    y_arg(const y::wvec2, v)
-{
-  y_return(y::abs(v));
-}
-
-y_api(vec__max)
-    y_arg(const y::wvec2, a) y_arg(const y::wvec2, b)
-{
-  y_return(y::max(a, b));
-}
-
-y_api(vec__min)
-    y_arg(const y::wvec2, a) y_arg(const y::wvec2, b)
-{
-  y_return(y::min(a, b));
-}
-
-typedef y::wvec2 Vec;
-y_valtypedef(Vec) {
-  y_method("__add", vec__add);
-  y_method("__sub", vec__sub);
-  y_method("__mul", vec__mul);
-  y_method("__div", vec__div);
-  y_method("__mod", vec__mod);
-  y_method("__unm", vec__unm);
-  y_method("x", vec__x);
-  y_method("y", vec__y);
-  y_method("normalised", vec__normalised);
-  y_method("normalise", vec__normalise);
-  y_method("dot", vec__dot);
-  y_method("length_squared", vec__length_squared);
-  y_method("length", vec__length);
-  y_method("angle", vec__angle);
-  y_method("in_region", vec__in_region);
-  y_method("abs", vec__abs);
-  y_method("max", vec__max);
-  y_method("min", vec__min);
-} y_endtypedef();
+// Vectors are LuaJIT FFI structs rather than userdata, and their API is
+// written in Lua: see vec_source in lua.cpp.
 
 /******************************************************************************/
 // Script reference API
@@ -239,34 +88,46 @@ y_api(script__get_rotation)
 y_api(script__set_region)
     y_arg(Script*, script) y_arg(const y::wvec2, region)
 {
-  script->set_region(region);
+  stage.get_scripts().run_or_defer([=]()
+  {
+    script->set_region(region);
+  });
   y_void();
 }
 
 y_api(script__set_origin)
     y_arg(Script*, script) y_arg(const y::wvec2, origin)
 {
-  script->set_origin(origin);
+  stage.get_scripts().run_or_defer([=]()
+  {
+    script->set_origin(origin);
+  });
   y_void();
 }
 
 y_api(script__set_rotation)
     y_arg(Script*, script) y_arg(y::world, rotation)
 {
-  script->set_rotation(rotation);
+  stage.get_scripts().run_or_defer([=]()
+  {
+    script->set_rotation(rotation);
+  });
   y_void();
 }
 
 y_api(script__destroy)
     y_arg(Script*, script)
 {
-  script->destroy();
+  stage.get_scripts().run_or_defer([=]()
+  {
+    script->destroy();
+  });
   y_void();
 }
 
 y_api(script__send_message)
-    y_arg(Script*, script) y_arg(std::string, function_name)
-    y_varargs(LuaValue, args)
+    y_arg(Script*, script) y_arg(const char*, function_name)
+    y_arg(LuaStackArgs, args)
 {
   stage.get_scripts().send_message(script, function_name, args);
   y_void();
@@ -276,6 +137,8 @@ y_api(script__create_body)
     y_arg(Script*, script)
     y_arg(const y::wvec2, offset) y_arg(const y::wvec2, size)
 {
+  y_check(!stage.get_scripts().is_deferring(),
+          "Can't create bodies in update_parallel");
   Body* body = stage.get_collision().get_data().create_obj(*script);
   body->offset = offset;
   body->size = size;
@@ -285,7 +148,10 @@ y_api(script__create_body)
 y_api(script__destroy_bodies)
     y_arg(const Script*, script)
 {
-  stage.get_collision().get_data().destroy_all(*script);
+  stage.get_scripts().run_or_defer([&stage, script]()
+  {
+    stage.get_collision().get_data().destroy_all(*script);
+  });
   y_void();
 }
 
@@ -293,6 +159,8 @@ y_api(script__create_constraint)
     y_arg(Script*, script) y_arg(Script*, target)
     y_arg(bool, fixed) y_arg(bool, target_fixed) y_optarg(std::int32_t, tag)
 {
+  y_check(!stage.get_scripts().is_deferring(),
+          "Can't create constraints in update_parallel");
   stage.get_collision().get_constraints().create_constraint(
       *script, *target, fixed, target_fixed, tag_defined ? tag : 0);
   y_void();
@@ -324,12 +192,16 @@ y_api(script__get_constraints)
 y_api(script__destroy_constraints)
     y_arg(Script*, script) y_optarg(std::int32_t, tag)
 {
-  if (tag_defined) {
-    stage.get_collision().get_constraints().destroy_constraints(*script, tag);
-  }
-  else {
-    stage.get_collision().get_constraints().destroy_constraints(*script);
-  }
+  stage.get_scripts().run_or_defer([&stage, script, tag, tag_defined]()
+  {
+    if (tag_defined) {
+      stage.get_collision().get_constraints().destroy_constraints(
+          *script, tag);
+    }
+    else {
+      stage.get_collision().get_constraints().destroy_constraints(*script);
+    }
+  });
   y_void();
 }
 
@@ -337,12 +209,25 @@ y_api(script__collider_move)
     y_arg(Script*, script) y_arg(const y::wvec2, move)
     y_optarg(std::int32_t, push_mask) y_optarg(std::int32_t, push_max)
 {
-  std::vector<Script*> push_scripts;
-  std::vector<y::wvec2> push_amounts;
-  y::wvec2 moved = stage.get_collision().collider_move(
-      push_scripts, push_amounts,
-      *script, move, push_mask_defined ? push_mask : 0,
-      push_max_defined && push_max >= 0 ? push_max : 64);
+  std::int32_t mask = push_mask_defined ? push_mask : 0;
+  std::int32_t max = push_max_defined && push_max >= 0 ? push_max : 64;
+  // When deferred, the move hasn't happened yet, so nothing has moved.
+  y::wvec2 moved;
+  if (stage.get_scripts().is_deferring()) {
+    stage.get_scripts().run_or_defer([&stage, script, move, mask, max]()
+    {
+      std::vector<Script*> push_scripts;
+      std::vector<y::wvec2> push_amounts;
+      stage.get_collision().collider_move(
+          push_scripts, push_amounts, *script, move, mask, max);
+    });
+  }
+  else {
+    std::vector<Script*> push_scripts;
+    std::vector<y::wvec2> push_amounts;
+    moved = stage.get_collision().collider_move(
+        push_scripts, push_amounts, *script, move, mask, max);
+  }
   y_return(moved);
 }
 
@@ -350,6 +235,8 @@ y_api(script__collider_move_detail)
     y_arg(Script*, script) y_arg(const y::wvec2, move)
     y_optarg(std::int32_t, push_mask) y_optarg(std::int32_t, push_max)
 {
+  y_check(!stage.get_scripts().is_deferring(),
+          "Can't use collider_move_detail in update_parallel");
   std::vector<Script*> push_scripts;
   std::vector<y::wvec2> push_amounts;
   y::wvec2 moved = stage.get_collision().collider_move(
@@ -363,6 +250,8 @@ y_api(script__collider_rotate)
     y_arg(Script*, script) y_arg(y::world, rotate)
     y_optarg(const y::wvec2, origin_offset)
 {
+  y_check(!stage.get_scripts().is_deferring(),
+          "Can't use collider_rotate in update_parallel");
   y_return(stage.get_collision().collider_rotate(
       *script, rotate, origin_offset_defined ? origin_offset : y::wvec2()));
 }
@@ -398,6 +287,8 @@ y_api(script__create_light)
     y_arg(Script*, script)
     y_arg(y::world, full_range) y_arg(y::world, falloff_range)
 {
+  y_check(!stage.get_scripts().is_deferring(),
+          "Can't create lights in update_parallel");
   Light* light = stage.get_lighting().create_obj(*script);
   light->full_range = full_range;
   light->falloff_range = falloff_range;
@@ -408,7 +299,10 @@ y_api(script__create_light)
 y_api(script__destroy_lights)
     y_arg(const Script*, script)
 {
-  stage.get_lighting().destroy_all(*script);
+  stage.get_scripts().run_or_defer([&stage, script]()
+  {
+    stage.get_lighting().destroy_all(*script);
+  });
   y_void();
 }
 
@@ -452,6 +346,8 @@ y_api(get_script)
 y_api(create_script)
     y_arg(const LuaFile*, file) y_arg(const y::wvec2, origin)
 {
+  y_check(!stage.get_scripts().is_deferring(),
+          "Can't create scripts in update_parallel");
   y_return(&stage.get_scripts().create_script(*file, origin));
 }
 
@@ -459,6 +355,8 @@ y_api(create_script_region)
     y_arg(const LuaFile*, file)
     y_arg(const y::wvec2, origin) y_arg(const y::wvec2, region)
 {
+  y_check(!stage.get_scripts().is_deferring(),
+          "Can't create scripts in update_parallel");
   y_return(&stage.get_scripts().create_script(*file, origin, region));
 }
 
@@ -501,13 +399,19 @@ y_api(get_bodies_in_radius)
 y_api(set_player)
     y_arg(Script*, script)
 {
-  stage.set_player(script);
+  stage.get_scripts().run_or_defer([&stage, script]()
+  {
+    stage.set_player(script);
+  });
   y_void();
 }
 
 y_api(clear_player)
 {
-  stage.set_player(nullptr);
+  stage.get_scripts().run_or_defer([&stage]()
+  {
+    stage.set_player(nullptr);
+  });
   y_void();
 }
 
@@ -530,7 +434,10 @@ y_api(is_key_down)
 y_api(set_camera)
     y_arg(const y::wvec2, camera)
 {
-  stage.get_camera().set_origin(camera);
+  stage.get_scripts().run_or_defer([&stage, camera]()
+  {
+    stage.get_camera().set_origin(camera);
+  });
   y_void();
 }
 
@@ -542,7 +449,10 @@ y_api(get_camera)
 y_api(set_camera_rotation)
     y_arg(y::world, rotation)
 {
-  stage.get_camera().set_rotation(rotation);
+  stage.get_scripts().run_or_defer([&stage, rotation]()
+  {
+    stage.get_camera().set_rotation(rotation);
+  });
   y_void();
 }
 
@@ -551,10 +461,35 @@ y_api(get_camera_rotation)
   y_return(stage.get_camera().get_rotation());
 }
 
+y_api(set_light_quality)
+    y_arg(std::int32_t, quality)
+{
+  y_check(quality == GameRenderer::LIGHT_QUALITY_FULL ||
+          quality == GameRenderer::LIGHT_QUALITY_HALF ||
+          quality == GameRenderer::LIGHT_QUALITY_QUARTER,
+          "Invalid light quality");
+  stage.get_renderer().set_light_quality(
+      GameRenderer::light_quality(quality));
+  y_void();
+}
+
+y_api(get_light_quality)
+{
+  y_return(std::int32_t(stage.get_renderer().get_light_quality()));
+}
+
 y_api(savegame_put)
     y_arg(std::string, key) y_arg(LuaValue, value)
 {
-  stage.get_savegame().put(key, value);
+  if (stage.get_scripts().is_deferring()) {
+    stage.get_scripts().run_or_defer([&stage, key, value]()
+    {
+      stage.get_savegame().put(key, value);
+    });
+  }
+  else {
+    stage.get_savegame().put(key, std::move(value));
+  }
   y_void();
 }
 
@@ -566,7 +501,10 @@ y_api(savegame_get)
 
 y_api(savegame_save)
 {
-  stage.save_game();
+  stage.get_scripts().run_or_defer([&stage]()
+  {
+    stage.save_game();
+  });
   y_void();
 }
 
@@ -596,25 +534,28 @@ y_api(add_particle)
     y_optarg(y::world, d2r) y_optarg(y::world, d2g)
     y_optarg(y::world, d2b) y_optarg(y::world, d2a)
 {
-  stage.get_environment().add_particle(
-      Particle(
-          tag, frames, bounce_coefficient,
-          Derivatives<y::wvec2>{p, dp, d2p},
-          layer, depth,
-          Derivatives<y::world>{size, dsize, d2size},
-          Derivatives<y::fvec4>{
-              y::fvec4(r_defined ? float(r) : 0.f,
-                       g_defined ? float(g) : 0.f,
-                       b_defined ? float(b) : 0.f,
-                       a_defined ? float(a) : 1.f),
-              y::fvec4(dr_defined ? float(dr) : 0.f,
-                       dg_defined ? float(dg) : 0.f,
-                       db_defined ? float(db) : 0.f,
-                       da_defined ? float(da) : 0.f),
-              y::fvec4(d2r_defined ? float(d2r) : 0.f,
-                       d2g_defined ? float(d2g) : 0.f,
-                       d2b_defined ? float(d2b) : 0.f,
-                       d2a_defined ? float(d2a) : 0.f)}));
+  Particle particle(
+      tag, frames, bounce_coefficient,
+      Derivatives<y::wvec2>{p, dp, d2p},
+      layer, depth,
+      Derivatives<y::world>{size, dsize, d2size},
+      Derivatives<y::fvec4>{
+          y::fvec4(r_defined ? float(r) : 0.f,
+                   g_defined ? float(g) : 0.f,
+                   b_defined ? float(b) : 0.f,
+                   a_defined ? float(a) : 1.f),
+          y::fvec4(dr_defined ? float(dr) : 0.f,
+                   dg_defined ? float(dg) : 0.f,
+                   db_defined ? float(db) : 0.f,
+                   da_defined ? float(da) : 0.f),
+          y::fvec4(d2r_defined ? float(d2r) : 0.f,
+                   d2g_defined ? float(d2g) : 0.f,
+                   d2b_defined ? float(d2b) : 0.f,
+                   d2a_defined ? float(d2a) : 0.f)});
+  stage.get_scripts().run_or_defer([&stage, particle]()
+  {
+    stage.get_environment().add_particle(particle);
+  });
   y_void();
 }
 
@@ -633,25 +574,28 @@ y_api(add_textured_particle)
     y_optarg(y::world, d2r) y_optarg(y::world, d2g)
     y_optarg(y::world, d2b) y_optarg(y::world, d2a)
 {
-  stage.get_environment().add_particle(
-      Particle(
-          tag, frames, bounce_coefficient,
-          Derivatives<y::wvec2>{p, dp, d2p},
-          layer, depth,
-          Derivatives<y::fvec4>{
-              y::fvec4(r_defined ? float(r) : 0.f,
-                       g_defined ? float(g) : 0.f,
-                       b_defined ? float(b) : 0.f,
-                       a_defined ? float(a) : 1.f),
-              y::fvec4(dr_defined ? float(dr) : 0.f,
-                       dg_defined ? float(dg) : 0.f,
-                       db_defined ? float(db) : 0.f,
-                       da_defined ? float(da) : 0.f),
-              y::fvec4(d2r_defined ? float(d2r) : 0.f,
-                       d2g_defined ? float(d2g) : 0.f,
-                       d2b_defined ? float(d2b) : 0.f,
-                       d2a_defined ? float(d2a) : 0.f)},
-          *sprite, y::ivec2(frame_size), y::ivec2(frame)));
+  Particle particle(
+      tag, frames, bounce_coefficient,
+      Derivatives<y::wvec2>{p, dp, d2p},
+      layer, depth,
+      Derivatives<y::fvec4>{
+          y::fvec4(r_defined ? float(r) : 0.f,
+                   g_defined ? float(g) : 0.f,
+                   b_defined ? float(b) : 0.f,
+                   a_defined ? float(a) : 1.f),
+          y::fvec4(dr_defined ? float(dr) : 0.f,
+                   dg_defined ? float(dg) : 0.f,
+                   db_defined ? float(db) : 0.f,
+                   da_defined ? float(da) : 0.f),
+          y::fvec4(d2r_defined ? float(d2r) : 0.f,
+                   d2g_defined ? float(d2g) : 0.f,
+                   d2b_defined ? float(d2b) : 0.f,
+                   d2a_defined ? float(d2a) : 0.f)},
+      *sprite, y::ivec2(frame_size), y::ivec2(frame));
+  stage.get_scripts().run_or_defer([&stage, particle]()
+  {
+    stage.get_environment().add_particle(particle);
+  });
   y_void();
 }
 
@@ -677,13 +621,16 @@ y_api(add_rope)
   params.ground_friction = ground_friction;
   params.bounce_coefficient = bounce_coefficient;
 
-  stage.get_environment().add_rope(
-      Rope(point_masses, length,
-           script_start_defined ? script_start : nullptr,
-           script_end_defined ? script_end : nullptr,
-           v0, script_start_defined && !script_end_defined ? v0 : v1,
-           params, layer, depth, size,
-           y::fvec4{float(r), float(g), float(b), float(a)}));
+  Rope rope(point_masses, length,
+            script_start_defined ? script_start : nullptr,
+            script_end_defined ? script_end : nullptr,
+            v0, script_start_defined && !script_end_defined ? v0 : v1,
+            params, layer, depth, size,
+            y::fvec4{float(r), float(g), float(b), float(a)});
+  stage.get_scripts().run_or_defer([&stage, rope]()
+  {
+    stage.get_environment().add_rope(rope);
+  });
   y_void();
 }
 
@@ -710,21 +657,27 @@ y_api(add_textured_rope)
   params.ground_friction = ground_friction;
   params.bounce_coefficient = bounce_coefficient;
 
-  stage.get_environment().add_rope(
-      Rope(point_masses, length,
-           script_start_defined ? script_start : nullptr,
-           script_end_defined ? script_end : nullptr,
-           v0, script_start_defined && !script_end_defined ? v0 : v1,
-           params, layer, depth,
-           y::fvec4{float(r), float(g), float(b), float(a)},
-           *sprite, y::ivec2(frame_size), y::ivec2(frame)));
+  Rope rope(point_masses, length,
+            script_start_defined ? script_start : nullptr,
+            script_end_defined ? script_end : nullptr,
+            v0, script_start_defined && !script_end_defined ? v0 : v1,
+            params, layer, depth,
+            y::fvec4{float(r), float(g), float(b), float(a)},
+            *sprite, y::ivec2(frame_size), y::ivec2(frame));
+  stage.get_scripts().run_or_defer([&stage, rope]()
+  {
+    stage.get_environment().add_rope(rope);
+  });
   y_void();
 }
 
 y_api(destroy_particles)
     y_arg(std::int32_t, tag)
 {
-  stage.get_environment().destroy_particles(tag);
+  stage.get_scripts().run_or_defer([&stage, tag]()
+  {
+    stage.get_environment().destroy_particles(tag);
+  });
   y_void();
 }
 
@@ -733,8 +686,11 @@ y_api(modify_particles)
     y_arg(const y::wvec2, p_add) y_arg(const y::wvec2, dp_add)
     y_arg(const y::wvec2, d2p_add)
 {
-  stage.get_environment().modify_particles(
-      tag, Derivatives<y::wvec2>{p_add, dp_add, d2p_add});
+  Derivatives<y::wvec2> modify{p_add, dp_add, d2p_add};
+  stage.get_scripts().run_or_defer([&stage, tag, modify]()
+  {
+    stage.get_environment().modify_particles(tag, modify);
+  });
   y_void();
 }
 
@@ -746,19 +702,10 @@ y_api(render_sprite)
     y_arg(y::world, r) y_arg(y::world, g) y_arg(y::world, b)
     y_arg(y::world, a)
 {
-  const GameRenderer& renderer = stage.get_renderer();
-  bool normal = renderer.draw_pass_is_normal();
-
-  RenderBatch& batch = renderer.get_current_batch();
-  const GlTexture2D& texture = normal ? sprite->normal : sprite->texture;
-
-  if (renderer.draw_pass_is_layer(GameRenderer::draw_layer(layer))) {
-    renderer.set_current_draw_any();
-    batch.add_sprite(texture, y::ivec2(frame_size), normal,
-                     y::fvec2(origin - frame_size / 2), y::ivec2(frame),
-                     depth, rotation,
-                     y::fvec4{float(r), float(g), float(b), float(a)});
-  }
+  stage.get_renderer().render_sprite(
+      layer, *sprite, y::ivec2(frame_size),
+      y::fvec2(origin - frame_size / 2), y::ivec2(frame), depth, rotation,
+      y::fvec4{float(r), float(g), float(b), float(a)});
   y_void();
 }
 
@@ -771,7 +718,6 @@ y_api(render_fog)
     y_arg(y::world, fog_min) y_arg(y::world, fog_max)
     y_optarg(bool, normal_only)
 {
-  const GameRenderer& renderer = stage.get_renderer();
   Environment::fog_params params;
   params.layering_value = layering_value;
   params.tex_offset = tex_offset;
@@ -781,21 +727,8 @@ y_api(render_fog)
   params.fog_max = fog_max;
   params.normal_only = normal_only_defined && normal_only;
 
-  if (renderer.draw_pass_is_layer(GameRenderer::draw_layer(layer))) {
-    renderer.set_current_draw_any();
-    if (renderer.draw_pass_is_normal()) {
-      stage.get_environment().render_fog_normal(
-          renderer.get_util(), origin, region, params);
-    }
-    else {
-      if (normal_only) {
-        goto end;
-      }
-      stage.get_environment().render_fog_colour(
-          renderer.get_util(), origin, region, params);
-    }
-  }
-end:
+  stage.get_renderer().render_fog(
+      stage.get_environment(), layer, origin, region, params);
   y_void();
 }
 
@@ -815,7 +748,6 @@ y_api(render_reflect)
     y_arg(y::world, wave_height) y_arg(y::world, wave_scale)
     y_optarg(bool, normal_only)
 {
-  const GameRenderer& renderer = stage.get_renderer();
   Environment::reflect_params params;
   params.layering_value = layering_value;
   params.tex_offset = tex_offset;
@@ -835,22 +767,8 @@ y_api(render_reflect)
   params.wave_scale = wave_scale;
   params.normal_only = normal_only_defined && normal_only;
 
-  if (renderer.draw_pass_is_layer(GameRenderer::draw_layer(layer))) {
-    renderer.set_current_draw_any();
-    if (renderer.draw_pass_is_normal()) {
-      stage.get_environment().render_reflect_normal(
-          renderer.get_util(), origin, region, params);
-    }
-    else {
-      if (normal_only) {
-        goto end;
-      }
-      stage.get_environment().render_reflect_colour(
-          renderer.get_util(), origin, region, params,
-          renderer.get_framebuffer());
-    }
-  }
-end:
+  stage.get_renderer().render_reflect(
+      stage.get_environment(), layer, origin, region, params);
   y_void();
 }
 
@@ -917,30 +835,42 @@ y_api(body__get_collide_mask)
 y_api(body__set_offset)
     y_arg(Body*, body) y_arg(const y::wvec2, offset)
 {
-  body->offset = offset;
-  body->source.set_origin(body->source.get_origin());
+  stage.get_scripts().run_or_defer(stage.get_collision().get_data(), body, [=]()
+  {
+    body->offset = offset;
+    body->source.set_origin(body->source.get_origin());
+  });
   y_void();
 }
 
 y_api(body__set_size)
     y_arg(Body*, body) y_arg(const y::wvec2, size)
 {
-  body->size = size;
-  body->source.set_origin(body->source.get_origin());
+  stage.get_scripts().run_or_defer(stage.get_collision().get_data(), body, [=]()
+  {
+    body->size = size;
+    body->source.set_origin(body->source.get_origin());
+  });
   y_void();
 }
 
 y_api(body__set_collide_type)
     y_arg(Body*, body) y_arg(std::int32_t, collide_type)
 {
-  body->collide_type = collide_type;
+  stage.get_scripts().run_or_defer(stage.get_collision().get_data(), body, [=]()
+  {
+    body->collide_type = collide_type;
+  });
   y_void();
 }
 
 y_api(body__set_collide_mask)
     y_arg(Body*, body) y_arg(std::int32_t, collide_mask)
 {
-  body->collide_mask = collide_mask;
+  stage.get_scripts().run_or_defer(stage.get_collision().get_data(), body, [=]()
+  {
+    body->collide_mask = collide_mask;
+  });
   y_void();
 }
 
@@ -982,7 +912,11 @@ y_api(body__get_bodies_in_body)
 y_api(body__destroy)
     y_arg(Body*, body)
 {
-  stage.get_collision().get_data().destroy_obj(body->source, body);
+  CollisionData& data = stage.get_collision().get_data();
+  stage.get_scripts().run_or_defer(data, body, [&data, body]()
+  {
+    data.destroy_obj(body->source, body);
+  });
   y_void();
 }
 
@@ -1015,7 +949,10 @@ y_api(light__get_offset)
 y_api(light__set_offset)
     y_arg(Light*, light) y_arg(const y::wvec2, offset)
 {
-  light->offset = offset;
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->offset = offset;
+  });
   y_void();
 }
 
@@ -1028,7 +965,10 @@ y_api(light__get_normal_vec)
 y_api(light__set_normal_vec)
     y_arg(Light*, light) y_arg(const y::wvec2, normal_vec)
 {
-  light->normal_vec = normal_vec.normalised();
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->normal_vec = normal_vec.normalised();
+  });
   y_void();
 }
 
@@ -1041,7 +981,10 @@ y_api(light__get_full_range)
 y_api(light__set_full_range)
     y_arg(Light*, light) y_arg(y::world, full_range)
 {
-  light->full_range = full_range;
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->full_range = full_range;
+  });
   y_void();
 }
 
@@ -1054,7 +997,10 @@ y_api(light__get_falloff_range)
 y_api(light__set_falloff_range)
     y_arg(Light*, light) y_arg(y::world, falloff_range)
 {
-  light->falloff_range = falloff_range;
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->falloff_range = falloff_range;
+  });
   y_void();
 }
 
@@ -1067,7 +1013,10 @@ y_api(light__get_layer_value)
 y_api(light__set_layer_value)
     y_arg(Light*, light) y_arg(y::world, layer_value)
 {
-  light->layer_value = layer_value;
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->layer_value = layer_value;
+  });
   y_void();
 }
 
@@ -1083,9 +1032,12 @@ y_api(light__set_colour)
     y_arg(Light*, light)
     y_arg(y::world, r) y_arg(y::world, g) y_arg(y::world, b)
 {
-  light->colour[rr] = r;
-  light->colour[gg] = g;
-  light->colour[bb] = b;
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->colour[rr] = r;
+    light->colour[gg] = g;
+    light->colour[bb] = b;
+  });
   y_void();
 }
 
@@ -1098,7 +1050,10 @@ y_api(light__get_intensity)
 y_api(light__set_intensity)
     y_arg(Light*, light) y_arg(y::world, intensity)
 {
-  light->colour[aa] = intensity;
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->colour[aa] = intensity;
+  });
   y_void();
 }
 
@@ -1111,7 +1066,10 @@ y_api(light__get_angle)
 y_api(light__set_angle)
     y_arg(Light*, light) y_arg(y::world, angle)
 {
-  light->angle = y::angle(angle);
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->angle = y::angle(angle);
+  });
   y_void();
 }
 
@@ -1124,7 +1082,26 @@ y_api(light__get_aperture)
 y_api(light__set_aperture)
     y_arg(Light*, light) y_arg(y::world, aperture)
 {
-  light->aperture = aperture;
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->aperture = aperture;
+  });
+  y_void();
+}
+
+y_api(light__get_static)
+    y_arg(const Light*, light)
+{
+  y_return(light->is_static);
+}
+
+y_api(light__set_static)
+    y_arg(Light*, light) y_arg(bool, is_static)
+{
+  stage.get_scripts().run_or_defer(stage.get_lighting(), light, [=]()
+  {
+    light->is_static = is_static;
+  });
   y_void();
 }
 
@@ -1137,7 +1114,11 @@ y_api(light__get_source)
 y_api(light__destroy)
     y_arg(Light*, light)
 {
-  stage.get_lighting().destroy_obj(light->source, light);
+  Lighting& lighting = stage.get_lighting();
+  stage.get_scripts().run_or_defer(lighting, light, [&lighting, light]()
+  {
+    lighting.destroy_obj(light->source, light);
+  });
   y_void();
 }
 
@@ -1160,6 +1141,8 @@ y_ptrtypedef(Light) {
   y_method("set_angle", light__set_angle);
   y_method("get_aperture", light__get_aperture);
   y_method("set_aperture", light__set_aperture);
+  y_method("get_static", light__get_static);
+  y_method("set_static", light__set_static);
   y_method("get_source", light__get_source);
   y_method("destroy", light__destroy);
 } y_endtypedef();
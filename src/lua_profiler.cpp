@@ -0,0 +1,148 @@
+#include "lua_profiler.h"
+
+#include <algorithm>
+#include <lua/lua.hpp>
+
+namespace {
+  typedef std::chrono::high_resolution_clock hrclock;
+
+  std::size_t elapsed_ns(const hrclock::time_point& start)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        hrclock::now() - start).count();
+  }
+
+  std::size_t heap_bytes(lua_State* state)
+  {
+    return 1024 * std::size_t(lua_gc(state, LUA_GCCOUNT, 0)) +
+        std::size_t(lua_gc(state, LUA_GCCOUNTB, 0));
+  }
+}
+
+LuaProfiler::entry::entry()
+  : calls(0)
+  , api_calls(0)
+  , ns_total(0)
+  , ns_api(0)
+  , heap_bytes(0)
+{
+}
+
+LuaProfiler::call_scope::call_scope(
+    LuaProfiler& profiler, lua_State* state,
+    const std::string& path, const std::string& function)
+  : _profiler(profiler._enabled ? &profiler : nullptr)
+  , _state(state)
+{
+  if (!_profiler) {
+    return;
+  }
+  frame_data f;
+  f.stats = &_profiler->_entries[path][function];
+  f.api_calls = 0;
+  f.ns_api = 0;
+  f.heap_start = heap_bytes(_state);
+  f.start = hrclock::now();
+  _profiler->_stack.emplace_back(f);
+}
+
+LuaProfiler::call_scope::~call_scope()
+{
+  // The profile may have been reset during the call.
+  if (!_profiler || _profiler->_stack.empty()) {
+    return;
+  }
+  const frame_data& f = _profiler->_stack.back();
+  ++f.stats->calls;
+  f.stats->api_calls += f.api_calls;
+  f.stats->ns_total += elapsed_ns(f.start);
+  f.stats->ns_api += f.ns_api;
+  f.stats->heap_bytes +=
+      std::int64_t(heap_bytes(_state)) - std::int64_t(f.heap_start);
+  _profiler->_stack.pop_back();
+}
+
+LuaProfiler::api_scope::api_scope(LuaProfiler& profiler)
+  : _profiler(profiler._enabled && !profiler._stack.empty() ?
+              &profiler : nullptr)
+{
+  if (_profiler) {
+    _start = hrclock::now();
+  }
+}
+
+LuaProfiler::api_scope::~api_scope()
+{
+  if (!_profiler || _profiler->_stack.empty()) {
+    return;
+  }
+  frame_data& f = _profiler->_stack.back();
+  ++f.api_calls;
+  f.ns_api += elapsed_ns(_start);
+}
+
+LuaProfiler::LuaProfiler()
+  : _enabled(false)
+  , _frames(0)
+{
+}
+
+void LuaProfiler::set_enabled(bool enabled)
+{
+  _enabled = enabled;
+  if (enabled) {
+    _frames = 0;
+    _entries.clear();
+    _stack.clear();
+  }
+}
+
+bool LuaProfiler::is_enabled() const
+{
+  return _enabled;
+}
+
+void LuaProfiler::frame()
+{
+  if (_enabled) {
+    ++_frames;
+  }
+}
+
+std::size_t LuaProfiler::get_frames() const
+{
+  return _frames;
+}
+
+void LuaProfiler::get_rows(row_list& output) const
+{
+  for (const auto& path : _entries) {
+    for (const auto& function : path.second) {
+      output.push_back(row{&path.first, &function.first, &function.second});
+    }
+  }
+  std::sort(output.begin(), output.end(), [](const row& a, const row& b)
+  {
+    return a.stats->ns_total > b.stats->ns_total;
+  });
+}
+
+void LuaProfiler::write_csv(std::ostream& output) const
+{
+  row_list rows;
+  get_rows(rows);
+  const char* const columns[] = {
+    "path", "function", "frames", "calls", "api_calls",
+    "total_us", "api_us", "heap_bytes",
+  };
+  for (const char* column : columns) {
+    output << (column == columns[0] ? "" : ",") << column;
+  }
+  output << std::endl;
+  for (const row& r : rows) {
+    output << *r.path << "," << *r.function << "," << _frames << "," <<
+        r.stats->calls << "," << r.stats->api_calls << "," <<
+        r.stats->ns_total / 1000 << "," << r.stats->ns_api / 1000 << "," <<
+        r.stats->heap_bytes << std::endl;
+  }
+}
@@ -0,0 +1,113 @@
+#ifndef LUA_PROFILER_H
+#define LUA_PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct lua_State;
+
+// Accumulates the cost of calls to Script functions, per script path and
+// function name: call counts, inclusive wall time, time spent in C++ API
+// functions, and Lua heap growth. Off by default; while off, measuring a call
+// is a single flag check.
+class LuaProfiler {
+public:
+
+  struct entry {
+    entry();
+
+    std::size_t calls;
+    std::size_t api_calls;
+    std::size_t ns_total;
+    std::size_t ns_api;
+    // Net growth of the heap during calls. Collections that happen during a
+    // call can make this negative.
+    std::int64_t heap_bytes;
+  };
+
+  struct row {
+    const std::string* path;
+    const std::string* function;
+    const entry* stats;
+  };
+  typedef std::vector<row> row_list;
+
+  // Measures a Script function call while it's in scope.
+  class call_scope {
+  public:
+
+    call_scope(LuaProfiler& profiler, lua_State* state,
+               const std::string& path, const std::string& function);
+    ~call_scope();
+
+    call_scope(const call_scope&) = delete;
+    call_scope& operator=(const call_scope&) = delete;
+
+  private:
+
+    LuaProfiler* _profiler;
+    lua_State* _state;
+
+  };
+
+  // Measures a C++ API function while it's in scope. The time is
+  // attributed to the innermost Script function call.
+  class api_scope {
+  public:
+
+    api_scope(LuaProfiler& profiler);
+    ~api_scope();
+
+    api_scope(const api_scope&) = delete;
+    api_scope& operator=(const api_scope&) = delete;
+
+  private:
+
+    LuaProfiler* _profiler;
+    std::chrono::high_resolution_clock::time_point _start;
+
+  };
+
+  LuaProfiler();
+  LuaProfiler(const LuaProfiler&) = delete;
+  LuaProfiler& operator=(const LuaProfiler&) = delete;
+
+  // Enabling starts a new profile, discarding any previous results.
+  void set_enabled(bool enabled);
+  bool is_enabled() const;
+
+  // Count an update frame, so that results can be averaged per frame.
+  void frame();
+  std::size_t get_frames() const;
+
+  // Results sorted by total time, most expensive first.
+  void get_rows(row_list& output) const;
+  void write_csv(std::ostream& output) const;
+
+private:
+
+  typedef std::chrono::high_resolution_clock hrclock;
+
+  struct frame_data {
+    entry* stats;
+    hrclock::time_point start;
+    std::size_t api_calls;
+    std::size_t ns_api;
+    std::size_t heap_start;
+  };
+
+  typedef std::unordered_map<std::string, entry> function_map;
+  typedef std::unordered_map<std::string, function_map> path_map;
+
+  bool _enabled;
+  std::size_t _frames;
+  path_map _entries;
+  std::vector<frame_data> _stack;
+
+};
+
+#endif
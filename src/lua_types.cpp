@@ -1,116 +1,264 @@
 #include "lua_types.h"
+#include <cstring>
 
 LuaValue::LuaValue(void* userdata, const std::string& metatable)
-  : type(USERDATA)
-  , userdata(userdata)
-  , string(metatable)
+  : _type(USERDATA)
+  , _is_small(false)
+  , _small_size(0)
 {
+  _userdata.data = userdata;
+  _userdata.type = lua_generic_type_map[metatable].get();
 }
 
 LuaValue::LuaValue(y::world world)
-  : type(WORLD)
-  , userdata(nullptr)
-  , world(world)
+  : _type(WORLD)
+  , _is_small(false)
+  , _small_size(0)
+  , _world(world)
 {
 }
 
 LuaValue::LuaValue(bool boolean)
-  : type(BOOLEAN)
-  , userdata(nullptr)
-  , boolean(boolean)
+  : _type(BOOLEAN)
+  , _is_small(false)
+  , _small_size(0)
+  , _boolean(boolean)
 {
 }
 
+LuaValue::LuaValue(const char* string)
+{
+  set_string(string, std::strlen(string));
+}
+
+LuaValue::LuaValue(const char* string, std::size_t size)
+{
+  set_string(string, size);
+}
+
 LuaValue::LuaValue(const std::string& string)
-  : type(STRING)
-  , userdata(nullptr)
-  , string(string)
 {
+  set_string(string.data(), string.size());
 }
 
-LuaValue::LuaValue(const std::vector<LuaValue>& array)
-  : type(ARRAY)
-  , userdata(nullptr)
-  , array(array)
+LuaValue::LuaValue(const array_type& array)
+  : _type(ARRAY)
+  , _is_small(false)
+  , _small_size(0)
 {
+  new (&_array) shared_array(std::make_shared<array_type>(array));
+}
+
+LuaValue::LuaValue(array_type&& array)
+  : _type(ARRAY)
+  , _is_small(false)
+  , _small_size(0)
+{
+  new (&_array) shared_array(std::make_shared<array_type>(std::move(array)));
 }
 
 LuaValue::LuaValue(const LuaValue& value)
-  : type(WORLD)
-  , userdata(nullptr)
 {
-  operator=(value);
+  copy_from(value);
 }
 
 LuaValue::LuaValue(LuaValue&& value)
-  : type(WORLD)
-  , userdata(nullptr)
 {
-  operator=(value);
+  move_from(value);
 }
 
 LuaValue& LuaValue::operator=(const LuaValue& value)
 {
-  if (this == &value) {
-    return *this;
+  // The value might be owned by this one (for example, an element of its
+  // array), so copy it before clearing.
+  LuaValue copy(value);
+  clear();
+  move_from(copy);
+  return *this;
+}
+
+LuaValue& LuaValue::operator=(LuaValue&& value)
+{
+  if (this != &value) {
+    clear();
+    move_from(value);
   }
+  return *this;
+}
+
+LuaValue::~LuaValue()
+{
+  clear();
+}
+
+LuaValue::value_type LuaValue::type() const
+{
+  return _type;
+}
+
+void* LuaValue::userdata() const
+{
+  return _type == USERDATA ? _userdata.data : nullptr;
+}
+
+const LuaGenericType* LuaValue::userdata_type() const
+{
+  return _type == USERDATA ? _userdata.type : nullptr;
+}
+
+y::world LuaValue::world() const
+{
+  return _type == WORLD ? _world : 0.;
+}
+
+bool LuaValue::boolean() const
+{
+  return _type == BOOLEAN && _boolean;
+}
+
+const char* LuaValue::string() const
+{
+  return _type != STRING ? "" : _is_small ? _small : _string->c_str();
+}
 
-  if (type == USERDATA) {
-    lua_generic_type_map[string]->del(userdata);
-    userdata = nullptr;
+std::size_t LuaValue::string_size() const
+{
+  return _type != STRING ? 0 : _is_small ? _small_size : _string->size();
+}
+
+const LuaValue::array_type& LuaValue::array() const
+{
+  static const array_type empty;
+  return _type == ARRAY ? *_array : empty;
+}
+
+void LuaValue::set_string(const char* string, std::size_t size)
+{
+  _type = STRING;
+  _is_small = size <= small_string_capacity;
+  _small_size = _is_small ? size : 0;
+  if (_is_small) {
+    std::memcpy(_small, string, size);
+    _small[size] = '\0';
+  }
+  else {
+    new (&_string) shared_string(std::make_shared<std::string>(string, size));
   }
-  type = value.type;
+}
 
-  switch (type) {
+void LuaValue::copy_from(const LuaValue& value)
+{
+  _type = value._type;
+  _is_small = value._is_small;
+  _small_size = value._small_size;
+  switch (_type) {
     case USERDATA:
-      string = value.string;
-      userdata = lua_generic_type_map[string]->copy(value.userdata);
+      _userdata.type = value._userdata.type;
+      _userdata.data = _userdata.type->copy(value._userdata.data);
       break;
     case WORLD:
-      world = value.world;
+      _world = value._world;
       break;
     case BOOLEAN:
-      boolean = value.boolean;
+      _boolean = value._boolean;
       break;
     case STRING:
-      string = value.string;
+      if (_is_small) {
+        std::memcpy(_small, value._small, sizeof(_small));
+      }
+      else {
+        new (&_string) shared_string(value._string);
+      }
       break;
     case ARRAY:
-      array = value.array;
+      new (&_array) shared_array(value._array);
       break;
   }
-  return *this;
 }
 
-LuaValue& LuaValue::operator=(LuaValue&& value)
+void LuaValue::move_from(LuaValue& value)
 {
-  std::swap(type, value.type);
-  std::swap(userdata, value.userdata);
-  std::swap(world, value.world);
-  std::swap(boolean, value.boolean);
-  std::swap(string, value.string);
-  std::swap(array, value.array);
-  return *this;
+  _type = value._type;
+  _is_small = value._is_small;
+  _small_size = value._small_size;
+  switch (_type) {
+    case USERDATA:
+      // Ownership is transferred, so there's nothing left to free.
+      _userdata = value._userdata;
+      value._type = WORLD;
+      break;
+    case WORLD:
+      _world = value._world;
+      break;
+    case BOOLEAN:
+      _boolean = value._boolean;
+      break;
+    case STRING:
+      if (_is_small) {
+        std::memcpy(_small, value._small, sizeof(_small));
+      }
+      else {
+        new (&_string) shared_string(std::move(value._string));
+      }
+      break;
+    case ARRAY:
+      new (&_array) shared_array(std::move(value._array));
+      break;
+  }
+  value.clear();
 }
 
-LuaValue::~LuaValue()
+void LuaValue::clear()
 {
-  if (type == USERDATA) {
-    lua_generic_type_map[string]->del(userdata);
+  if (_type == USERDATA) {
+    _userdata.type->del(_userdata.data);
+  }
+  else if (_type == STRING && !_is_small) {
+    _string.~shared_string();
   }
+  else if (_type == ARRAY) {
+    _array.~shared_array();
+  }
+  _type = WORLD;
+  _is_small = false;
+  _small_size = 0;
+  _world = 0.;
 }
 
 LuaGenericTypeMap lua_generic_type_map;
 
+void LuaType<y::wvec2>::to_lua(lua_State* state, const void* v) const
+{
+  push(state, *reinterpret_cast<const y::wvec2*>(v));
+}
+
+void* LuaType<y::wvec2>::copy(const void* v) const
+{
+  return new y::wvec2(*reinterpret_cast<const y::wvec2*>(v));
+}
+
+void LuaType<y::wvec2>::del(void* v) const
+{
+  std::unique_ptr<y::wvec2> vec(reinterpret_cast<y::wvec2*>(v));
+}
+
 // Standard type names and values.
 const std::string LuaType<y::world>::type_name = "world";
 const std::string LuaType<std::int32_t>::type_name = "int";
 const std::string LuaType<bool>::type_name = "bool";
 const std::string LuaType<std::string>::type_name = "string";
+const std::string LuaType<const char*>::type_name = "string";
+const std::string LuaType<y::wvec2>::type_name = "y.Vec";
 const std::string LuaType<LuaValue>::type_name = "[value]";
+const std::string LuaType<LuaStackArgs>::type_name = "...";
 
 y::world LuaType<y::world>::default_value = 0.;
 std::int32_t LuaType<std::int32_t>::default_value = 0;
 bool LuaType<bool>::default_value = false;
 std::string LuaType<std::string>::default_value = "";
+const char* LuaType<const char*>::default_value = "";
+y::wvec2 LuaType<y::wvec2>::default_value;
 LuaValue LuaType<LuaValue>::default_value(0.);
+
+char LuaType<y::wvec2>::constructor_key = 0;
+std::uint16_t LuaType<y::wvec2>::ctype_id = 0;
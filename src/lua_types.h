@@ -2,6 +2,7 @@
 #define LUA_TYPES_H
 
 #include "common.h"
+#include "vec.h"
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -12,15 +13,30 @@
 
 typedef std::int32_t lua_int;
 
+struct LuaGenericType;
+
 // LuaValue hold a variety of different Lua types. We use LuaType<LuaValue> when
 // we don't care exactly what type something is, but want to use it between C++
 // and Lua. When we know the exact type T we're working with, we use LuaType<T>.
-struct LuaValue {
+//
+// The representation is compact: numbers, booleans and small strings are stored
+// inline, while longer strings and arrays are immutable and shared between
+// copies. Only userdata is copied deeply. A moved-from LuaValue is zero.
+class LuaValue {
+public:
+
+  typedef std::vector<LuaValue> array_type;
+
+  // Takes ownership of the userdata, whose type must be registered in
+  // lua_generic_type_map under the given name.
   LuaValue(void* userdata, const std::string& metatable);
   LuaValue(y::world world);
   LuaValue(bool boolean);
+  LuaValue(const char* string);
+  LuaValue(const char* string, std::size_t size);
   LuaValue(const std::string& string);
-  LuaValue(const std::vector<LuaValue>& array);
+  LuaValue(const array_type& array);
+  LuaValue(array_type&& array);
 
   LuaValue(const LuaValue& value);
   LuaValue(LuaValue&& value);
@@ -28,19 +44,65 @@ struct LuaValue {
   LuaValue& operator=(LuaValue&& value);
   ~LuaValue();
 
-  enum {
+  enum value_type : std::uint8_t {
     USERDATA,
     WORLD,
     BOOLEAN,
     STRING,
     ARRAY,
-  } type;
+  };
+  value_type type() const;
+
+  // Accessing a value of the wrong type gives zero, false or empty.
+  void* userdata() const;
+  const LuaGenericType* userdata_type() const;
+  y::world world() const;
+  bool boolean() const;
+  // Null-terminated, but may also contain nulls.
+  const char* string() const;
+  std::size_t string_size() const;
+  const array_type& array() const;
+
+private:
+
+  typedef std::shared_ptr<const std::string> shared_string;
+  typedef std::shared_ptr<const array_type> shared_array;
+  struct userdata_value {
+    void* data;
+    const LuaGenericType* type;
+  };
+
+  void set_string(const char* string, std::size_t size);
+  // These expect this value to hold nothing that needs freeing.
+  void copy_from(const LuaValue& value);
+  void move_from(LuaValue& value);
+  // Free whatever this value holds, and set it to zero.
+  void clear();
+
+  static const std::size_t small_string_capacity = 15;
+
+  value_type _type;
+  bool _is_small;
+  std::uint8_t _small_size;
+  union {
+    y::world _world;
+    bool _boolean;
+    userdata_value _userdata;
+    char _small[1 + small_string_capacity];
+    shared_string _string;
+    shared_array _array;
+  };
 
-  void* userdata;
-  y::world world;
-  bool boolean;
-  std::string string;
-  std::vector<LuaValue> array;
+};
+
+// The remaining arguments to a function, left in place on the stack so that
+// they can be read without converting each one to a LuaValue. Only valid
+// during the function call.
+struct LuaStackArgs {
+  inline lua_int size() const;
+
+  lua_State* state;
+  lua_int first;
 };
 
 // Base type for non-primitive (i.e. userdata) type information structures.
@@ -116,6 +178,18 @@ struct LuaType<std::string> {
   inline void push(lua_State* state, const std::string& arg) const;
 };
 
+// Borrowed string type. Doesn't copy, so only valid while the value remains on
+// the stack.
+template<>
+struct LuaType<const char*> {
+  static const std::string type_name;
+  static const char* default_value;
+
+  inline const char* get(lua_State* state, lua_int index) const;
+  inline bool is(lua_State* state, lua_int index) const;
+  inline void push(lua_State* state, const char* arg) const;
+};
+
 // Array type.
 template<typename T>
 struct LuaType<std::vector<T>> {
@@ -127,6 +201,43 @@ struct LuaType<std::vector<T>> {
   inline void push(lua_State* state, const std::vector<T>& arg) const;
 };
 
+// Vector type. Rather than userdata, vectors are LuaJIT FFI structs whose
+// metamethods are written in Lua, so that vector arithmetic in scripts can be
+// compiled without allocating. The struct is defined when the LuaVm is created.
+template<>
+struct LuaType<y::wvec2> : LuaGenericType {
+  static const std::string type_name;
+  static y::wvec2 default_value;
+
+  // LuaJIT 2.0 has no C API for cdata, but lua_type() gives this for any cdata
+  // and lua_topointer() returns a pointer to its payload. The payload directly
+  // follows this header (GCcdata in lj_obj.h).
+  static const lua_int cdata_type = 10;
+  struct cdata_header {
+    std::uint32_t next;
+    std::uint8_t marked;
+    std::uint8_t gct;
+    std::uint16_t ctype_id;
+  };
+
+  // Registry key of the constructor, and the FFI ID of the struct type, which
+  // is zero if it couldn't be defined. The struct is the first type defined in
+  // every Lua state, so the ID is always the same.
+  static char constructor_key;
+  static std::uint16_t ctype_id;
+
+  void to_lua(lua_State* state, const void* v) const override;
+  void* copy(const void* v) const override;
+  void del(void* v) const override;
+
+  inline y::wvec2& get(lua_State* state, lua_int index) const;
+  inline bool is(lua_State* state, lua_int index) const;
+  inline void push(lua_State* state, const y::wvec2& arg) const;
+};
+
+template<>
+struct LuaType<const y::wvec2> : LuaType<y::wvec2> {};
+
 // Generic LuaValue union type.
 template<>
 struct LuaType<LuaValue> {
@@ -138,6 +249,15 @@ struct LuaType<LuaValue> {
   inline void push(lua_State* state, const LuaValue& arg) const;
 };
 
+// Stack arguments type. Only useful as the last argument of an API function.
+template<>
+struct LuaType<LuaStackArgs> {
+  static const std::string type_name;
+
+  inline LuaStackArgs get(lua_State* state, lua_int index) const;
+  inline bool is(lua_State* state, lua_int index) const;
+};
+
 // Standard type names and values.
 template<typename T>
 const std::string LuaType<std::vector<T>>::type_name =
@@ -152,11 +272,7 @@ std::vector<T> LuaType<std::vector<T>>::default_value;
 template<typename T>
 void LuaType<T>::to_lua(lua_State* state, const void* v) const
 {
-  typedef typename std::remove_const<T>::type T_non_const;
-  T_non_const* t = reinterpret_cast<T_non_const*>(
-      lua_newuserdata(state, sizeof(T)));
-  const T& arg = *reinterpret_cast<const T*>(v);
-  new (t) T_non_const(arg);
+  push(state, *reinterpret_cast<const T*>(v));
 }
 
 template<typename T>
@@ -199,10 +315,12 @@ bool LuaType<T>::is(lua_State* state, lua_int index) const
 template<typename T>
 void LuaType<T>::push(lua_State* state, const T& arg) const
 {
-  T* t = reinterpret_cast<T*>(lua_newuserdata(state, sizeof(T)));
+  typedef typename std::remove_const<T>::type T_non_const;
+  T_non_const* t = reinterpret_cast<T_non_const*>(
+      lua_newuserdata(state, sizeof(T)));
   luaL_getmetatable(state, type_name.c_str());
   lua_setmetatable(state, -2);
-  new (t) T(arg);
+  new (t) T_non_const(arg);
 }
 
 // World scalar implementation.
@@ -269,6 +387,51 @@ void LuaType<std::string>::push(lua_State* state, const std::string& arg) const
   lua_pushstring(state, arg.c_str());
 }
 
+// Borrowed string implementation.
+const char* LuaType<const char*>::get(lua_State* state, lua_int index) const
+{
+  return lua_tostring(state, index);
+}
+
+bool LuaType<const char*>::is(lua_State* state, lua_int index) const
+{
+  return lua_isstring(state, index);
+}
+
+void LuaType<const char*>::push(lua_State* state, const char* arg) const
+{
+  lua_pushstring(state, arg);
+}
+
+// Vector implementation.
+y::wvec2& LuaType<y::wvec2>::get(lua_State* state, lua_int index) const
+{
+  return *reinterpret_cast<y::wvec2*>(
+      const_cast<void*>(lua_topointer(state, index)));
+}
+
+bool LuaType<y::wvec2>::is(lua_State* state, lua_int index) const
+{
+  if (!ctype_id || lua_type(state, index) != cdata_type) {
+    return false;
+  }
+  const cdata_header* header =
+      reinterpret_cast<const cdata_header*>(lua_topointer(state, index)) - 1;
+  return header->ctype_id == ctype_id;
+}
+
+void LuaType<y::wvec2>::push(lua_State* state, const y::wvec2& arg) const
+{
+  lua_pushlightuserdata(state, &constructor_key);
+  lua_rawget(state, LUA_REGISTRYINDEX);
+  if (lua_isnil(state, -1)) {
+    return;
+  }
+  lua_pushnumber(state, arg[xx]);
+  lua_pushnumber(state, arg[yy]);
+  lua_call(state, 2, 1);
+}
+
 // Array implementation.
 template<typename T>
 std::vector<T> LuaType<std::vector<T>>::get(
@@ -339,7 +502,9 @@ LuaValue LuaType<LuaValue>::get(lua_State* state, lua_int index) const
 
   LuaType<std::string> string;
   if (string.is(state, index)) {
-    return LuaValue(string.get(state, index));
+    std::size_t size = 0;
+    const char* data = lua_tolstring(state, index, &size);
+    return LuaValue(data, size);
   }
 
   LuaType<std::vector<LuaValue>> array;
@@ -347,6 +512,11 @@ LuaValue LuaType<LuaValue>::get(lua_State* state, lua_int index) const
     return LuaValue(array.get(state, index));
   }
 
+  LuaType<y::wvec2> vec;
+  if (vec.is(state, index)) {
+    return LuaValue(vec.copy(&vec.get(state, index)), vec.type_name);
+  }
+
   // Check for arbitrary userdata.
   void *v = lua_touserdata(state, index);
   if (v && lua_getmetatable(state, index)) {
@@ -366,6 +536,7 @@ bool LuaType<LuaValue>::is(lua_State* state, lua_int index) const
   LuaType<bool> boolean;
   LuaType<std::string> string;
   LuaType<std::vector<LuaValue>> array;
+  LuaType<y::wvec2> vec;
 
   void *v = lua_touserdata(state, index);
   bool is_userdata = v && lua_getmetatable(state, index);
@@ -378,31 +549,47 @@ bool LuaType<LuaValue>::is(lua_State* state, lua_int index) const
       world.is(state, index) ||
       boolean.is(state, index) ||
       string.is(state, index) ||
-      array.is(state, index);
+      array.is(state, index) ||
+      vec.is(state, index);
 }
 
 void LuaType<LuaValue>::push(lua_State* state, const LuaValue& arg) const
 {
-  switch (arg.type) {
+  switch (arg.type()) {
     case LuaValue::USERDATA:
-      lua_generic_type_map[arg.string]->to_lua(state, arg.userdata);
-      luaL_getmetatable(state, arg.string.c_str());
-      lua_setmetatable(state, -2);
+      arg.userdata_type()->to_lua(state, arg.userdata());
       break;
     case LuaValue::WORLD:
-      LuaType<y::world>().push(state, arg.world);
+      LuaType<y::world>().push(state, arg.world());
       break;
     case LuaValue::BOOLEAN:
-      LuaType<bool>().push(state, arg.boolean);
+      LuaType<bool>().push(state, arg.boolean());
       break;
     case LuaValue::STRING:
-      LuaType<std::string>().push(state, arg.string);
+      lua_pushlstring(state, arg.string(), arg.string_size());
       break;
     case LuaValue::ARRAY:
-      LuaType<std::vector<LuaValue>>().push(state, arg.array);
+      LuaType<std::vector<LuaValue>>().push(state, arg.array());
       break;
     default: {}
   }
 }
 
+// Stack arguments implementation.
+lua_int LuaStackArgs::size() const
+{
+  lua_int size = 1 + lua_gettop(state) - first;
+  return size > 0 ? size : 0;
+}
+
+LuaStackArgs LuaType<LuaStackArgs>::get(lua_State* state, lua_int index) const
+{
+  return LuaStackArgs{state, index};
+}
+
+bool LuaType<LuaStackArgs>::is(lua_State*, lua_int) const
+{
+  return true;
+}
+
 #endif
@@ -0,0 +1,231 @@
+#include "capture.h"
+#include "gl_util.h"
+
+#include "../log.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <SFML/Graphics.hpp>
+
+FrameCapture::FrameCapture(GlUtil& gl, const y::ivec2& size,
+                           const std::string& directory)
+  : _gl(gl)
+  , _size(size)
+  , _directory(directory)
+  , _recording(false)
+  , _captured(0)
+  , _pbo_next(0)
+  , _pbo_pending(0)
+  , _pbo_frames{}
+  , _written(0)
+  , _dropped(0)
+  , _finished(false)
+{
+}
+
+FrameCapture::~FrameCapture()
+{
+  if (!_thread.joinable()) {
+    return;
+  }
+  // Anything already queued is still written out.
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _finished = true;
+  }
+  _condition.notify_all();
+  _thread.join();
+}
+
+void FrameCapture::start()
+{
+  if (_recording) {
+    return;
+  }
+  if (!_thread.joinable()) {
+    allocate();
+  }
+
+  // The worker may still be writing frames from the last recording. It has
+  // finished once every frame buffer has been handed back.
+  std::unique_lock<std::mutex> lock(_mutex);
+  _idle_condition.wait(lock, [&]()
+  {
+    return _free.size() == queue_limit;
+  });
+  _recording = true;
+  _captured = 0;
+  _written = 0;
+  _dropped = 0;
+}
+
+void FrameCapture::stop(bool discard)
+{
+  if (!_recording) {
+    return;
+  }
+  _recording = false;
+  if (discard) {
+    _pbo_pending = 0;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (frame& f : _queue) {
+      _free.emplace_back();
+      _free.back().swap(f.pixels);
+    }
+    _queue.clear();
+    return;
+  }
+
+  // Waits for the outstanding transfers, but that's only once at the end.
+  while (_pbo_pending) {
+    collect();
+  }
+  std::lock_guard<std::mutex> lock(_mutex);
+  log_info("Recorded ", _captured, " frames (",
+           _dropped, " dropped) to ", _directory);
+}
+
+bool FrameCapture::is_recording() const
+{
+  return _recording;
+}
+
+void FrameCapture::capture()
+{
+  if (!_recording) {
+    return;
+  }
+  // Every buffer is busy, so the oldest has to be collected first. By now it
+  // was read into a couple of frames ago, so mapping it shouldn't block.
+  if (_pbo_pending == pbo_count) {
+    collect();
+  }
+
+  // With a pixel pack buffer bound, glReadPixels returns immediately and the
+  // transfer happens asynchronously.
+  _pbos[_pbo_next]->bind();
+  glReadPixels(0, 0, _size[xx], _size[yy], GL_RGBA, GL_UNSIGNED_BYTE, 0);
+  GlStateCache::bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  _pbo_frames[_pbo_next] = _captured++;
+  _pbo_next = (1 + _pbo_next) % pbo_count;
+  ++_pbo_pending;
+}
+
+std::size_t FrameCapture::get_frames_captured() const
+{
+  return _captured;
+}
+
+std::size_t FrameCapture::get_frames_written() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _written;
+}
+
+std::size_t FrameCapture::get_frames_dropped() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _dropped;
+}
+
+void FrameCapture::allocate()
+{
+  std::size_t length = 4 * _size[xx] * _size[yy];
+  for (std::size_t i = 0; i < pbo_count; ++i) {
+    _pbos.emplace_back(_gl.make_unique_buffer<GLubyte, 1>(
+        GL_PIXEL_PACK_BUFFER, GL_STREAM_READ));
+    _pbos.back()->bind();
+    glBufferData(GL_PIXEL_PACK_BUFFER, length, nullptr, GL_STREAM_READ);
+  }
+  GlStateCache::bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  for (std::size_t i = 0; i < queue_limit; ++i) {
+    _free.emplace_back(length);
+  }
+  _thread = std::thread(&FrameCapture::run, this);
+}
+
+void FrameCapture::collect()
+{
+  std::size_t index = (pbo_count + _pbo_next - _pbo_pending) % pbo_count;
+  --_pbo_pending;
+
+  std::vector<GLubyte> pixels;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_free.empty()) {
+      ++_dropped;
+      return;
+    }
+    pixels.swap(_free.back());
+    _free.pop_back();
+  }
+
+  _pbos[index]->bind();
+  const GLubyte* data =
+      static_cast<const GLubyte*>(
+          glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+  bool mapped = data != nullptr;
+  if (mapped) {
+    // Flip as we copy, since the framebuffer is stored bottom-up.
+    std::size_t row = 4 * _size[xx];
+    for (std::int32_t y = 0; y < _size[yy]; ++y) {
+      std::memcpy(&pixels[row * (_size[yy] - 1 - y)], data + row * y, row);
+    }
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  GlStateCache::bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!mapped) {
+      log_err("Couldn't map frame ", _pbo_frames[index]);
+      _free.emplace_back();
+      _free.back().swap(pixels);
+      ++_dropped;
+      return;
+    }
+    _queue.emplace_back();
+    _queue.back().index = _pbo_frames[index];
+    _queue.back().pixels.swap(pixels);
+  }
+  _condition.notify_one();
+}
+
+void FrameCapture::run()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _condition.wait(lock, [&]()
+    {
+      return _finished || !_queue.empty();
+    });
+    if (_queue.empty()) {
+      return;
+    }
+    frame f;
+    f.index = _queue.front().index;
+    f.pixels.swap(_queue.front().pixels);
+    _queue.pop_front();
+    lock.unlock();
+
+    sf::Image image;
+    image.create(_size[xx], _size[yy], f.pixels.data());
+    std::stringstream ss;
+    ss << _directory << std::setw(4) << std::setfill('0') << f.index << ".png";
+    bool saved = image.saveToFile(ss.str());
+
+    lock.lock();
+    _free.emplace_back();
+    _free.back().swap(f.pixels);
+    if (saved) {
+      ++_written;
+    }
+    else {
+      ++_dropped;
+    }
+    _idle_condition.notify_all();
+  }
+}
@@ -0,0 +1,88 @@
+#ifndef RENDER_CAPTURE_H
+#define RENDER_CAPTURE_H
+
+#include "gl_handle.h"
+#include "../vec.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class GlUtil;
+
+// Records frames to numbered PNG files without stalling rendering. Each frame
+// is read back into one of a ring of pixel buffer objects, and only mapped a
+// couple of frames later once the transfer has had time to finish. The pixels
+// are then handed to a worker thread which compresses and writes them out.
+// Memory use is fixed: if the worker falls behind, frames are dropped rather
+// than queued. Nothing is allocated and no thread is started until the first
+// recording.
+class FrameCapture {
+public:
+
+  FrameCapture(GlUtil& gl, const y::ivec2& size, const std::string& directory);
+  ~FrameCapture();
+
+  FrameCapture(const FrameCapture&) = delete;
+  FrameCapture& operator=(const FrameCapture&) = delete;
+
+  // Start a new recording, numbering frames from zero. Waits for any frames
+  // from the previous recording to finish being written.
+  void start();
+  // Stop recording. Frames still in flight are written out, unless discarded.
+  void stop(bool discard);
+  bool is_recording() const;
+
+  // Read back the currently-bound framebuffer, which should be the size given
+  // on construction. Does nothing when not recording.
+  void capture();
+
+  // Counts for the current (or most recent) recording.
+  std::size_t get_frames_captured() const;
+  std::size_t get_frames_written() const;
+  std::size_t get_frames_dropped() const;
+
+private:
+
+  struct frame {
+    std::size_t index;
+    std::vector<GLubyte> pixels;
+  };
+
+  // Create the pixel buffers, frame buffers and worker thread.
+  void allocate();
+  // Map the oldest pixel buffer still being read into and queue its contents.
+  void collect();
+  // Worker thread loop.
+  void run();
+
+  static const std::size_t pbo_count = 3;
+  static const std::size_t queue_limit = 8;
+
+  GlUtil& _gl;
+  y::ivec2 _size;
+  std::string _directory;
+
+  bool _recording;
+  std::size_t _captured;
+  std::size_t _pbo_next;
+  std::size_t _pbo_pending;
+  std::vector<GlUnique<GlBuffer<GLubyte, 1>>> _pbos;
+  std::size_t _pbo_frames[pbo_count];
+
+  // Shared with the worker thread.
+  mutable std::mutex _mutex;
+  std::condition_variable _condition;
+  std::condition_variable _idle_condition;
+  std::deque<frame> _queue;
+  std::vector<std::vector<GLubyte>> _free;
+  std::size_t _written;
+  std::size_t _dropped;
+  bool _finished;
+  std::thread _thread;
+
+};
+
+#endif
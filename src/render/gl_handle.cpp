@@ -1,5 +1,6 @@
 #include "gl_handle.h"
 #include "../log.h"
+#include <deque>
 #include <sstream>
 
 namespace {
@@ -60,6 +61,19 @@ void composite_type_to_base_and_length(GLenum type, GLenum& type_output,
   }
 }
 
+// Every name that has been interned, indexed by ID. Names can be interned
+// before main() runs, so the table is constructed on first use.
+struct name_table {
+  std::unordered_map<std::string, std::size_t> ids;
+  std::deque<std::string> names;
+};
+
+name_table& get_name_table()
+{
+  static name_table table;
+  return table;
+}
+
 // End anonymous namespace.
 }
 
@@ -114,8 +128,8 @@ const y::ivec2& GlFramebuffer::get_size() const
 
 void GlFramebuffer::bind(bool clear, bool clear_depth) const
 {
-  glBindFramebuffer(GL_FRAMEBUFFER, get_handle());
-  glViewport(0, 0, get_texture().get_size()[xx], get_texture().get_size()[yy]);
+  GlStateCache::bind_framebuffer(get_handle());
+  GlStateCache::viewport(get_texture().get_size());
   glClearColor(0.f, 0.f, 0.f, 0.f);
   glClearDepth(1.f);
   glClear((GL_COLOR_BUFFER_BIT * clear) | (GL_DEPTH_BUFFER_BIT * clear_depth));
@@ -136,44 +150,290 @@ GlShader::GlShader(GLuint handle)
 {
 }
 
+const GLsizeiptr GlStreamState::min_capacity;
+
+GlStreamState::GlStreamState()
+  : map_buffer_range(false)
+  , uploads(0)
+  , bytes(0)
+  , orphans(0)
+  , ns(0)
+{
+}
+
+const std::size_t GlStateCache::max_texture_units;
+const GLuint GlStateCache::unknown;
+GlStateCache* GlStateCache::_current = nullptr;
+
+GlStateCache::GlStateCache()
+  : issued(0)
+  , skipped(0)
+  , _program(unknown)
+  , _framebuffer(unknown)
+  , _viewport{-1, -1}
+  , _active_texture(0)
+  , _depth_func(0)
+  , _blend_source(0)
+  , _blend_target(0)
+{
+  for (std::size_t i = 0; i < max_texture_units; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      _textures[i][j] = unknown;
+    }
+  }
+  _current = this;
+}
+
+GlStateCache::~GlStateCache()
+{
+  if (_current == this) {
+    _current = nullptr;
+  }
+}
+
+void GlStateCache::use_program(GLuint program)
+{
+  if (!_current || !_current->skip(_current->_program == program)) {
+    glUseProgram(program);
+  }
+  if (_current) {
+    _current->_program = program;
+  }
+}
+
+void GlStateCache::bind_framebuffer(GLuint framebuffer)
+{
+  if (!_current || !_current->skip(_current->_framebuffer == framebuffer)) {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+  }
+  if (_current) {
+    _current->_framebuffer = framebuffer;
+  }
+}
+
+void GlStateCache::viewport(const y::ivec2& size)
+{
+  if (!_current || !_current->skip(_current->_viewport == size)) {
+    glViewport(0, 0, size[xx], size[yy]);
+  }
+  if (_current) {
+    _current->_viewport = size;
+  }
+}
+
+void GlStateCache::bind_buffer(GLenum target, GLuint buffer)
+{
+  if (!_current) {
+    glBindBuffer(target, buffer);
+    return;
+  }
+  auto it = _current->_buffers.find(target);
+  if (!_current->skip(it != _current->_buffers.end() &&
+                      it->second == buffer)) {
+    glBindBuffer(target, buffer);
+  }
+  _current->_buffers[target] = buffer;
+}
+
+void GlStateCache::bind_texture(GLenum unit, GLenum dimension, GLuint texture)
+{
+  std::size_t index = unit - GL_TEXTURE0;
+  if (!_current || index >= max_texture_units) {
+    glActiveTexture(unit);
+    glBindTexture(dimension, texture);
+    if (_current) {
+      _current->_active_texture = unit;
+    }
+    return;
+  }
+
+  GLuint& bound = _current->_textures[index][
+      _current->dimension_index(dimension)];
+  if (_current->skip(bound == texture)) {
+    return;
+  }
+  // The active unit only matters for binding, so it doesn't need to change
+  // if the texture is already bound.
+  if (_current->_active_texture != unit) {
+    glActiveTexture(unit);
+    _current->_active_texture = unit;
+  }
+  glBindTexture(dimension, texture);
+  bound = texture;
+}
+
+void GlStateCache::enable(GLenum capability, bool enable)
+{
+  if (_current) {
+    auto it = _current->_capabilities.find(capability);
+    bool same = it != _current->_capabilities.end() && it->second == enable;
+    _current->_capabilities[capability] = enable;
+    if (_current->skip(same)) {
+      return;
+    }
+  }
+  if (enable) {
+    glEnable(capability);
+  }
+  else {
+    glDisable(capability);
+  }
+}
+
+void GlStateCache::depth_func(GLenum test)
+{
+  if (!_current || !_current->skip(_current->_depth_func == test)) {
+    glDepthFunc(test);
+  }
+  if (_current) {
+    _current->_depth_func = test;
+  }
+}
+
+void GlStateCache::blend_func(GLenum source, GLenum target)
+{
+  if (!_current || !_current->skip(_current->_blend_source == source &&
+                                   _current->_blend_target == target)) {
+    glBlendFunc(source, target);
+  }
+  if (_current) {
+    _current->_blend_source = source;
+    _current->_blend_target = target;
+  }
+}
+
+void GlStateCache::forget_program(GLuint program)
+{
+  if (_current && _current->_program == program) {
+    _current->_program = unknown;
+  }
+}
+
+void GlStateCache::forget_framebuffer(GLuint framebuffer)
+{
+  if (_current && _current->_framebuffer == framebuffer) {
+    _current->_framebuffer = unknown;
+  }
+}
+
+void GlStateCache::forget_buffer(GLuint buffer)
+{
+  if (!_current) {
+    return;
+  }
+  for (auto& pair : _current->_buffers) {
+    if (pair.second == buffer) {
+      pair.second = unknown;
+    }
+  }
+}
+
+void GlStateCache::forget_texture(GLuint texture)
+{
+  if (!_current) {
+    return;
+  }
+  for (std::size_t i = 0; i < max_texture_units; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      if (_current->_textures[i][j] == texture) {
+        _current->_textures[i][j] = unknown;
+      }
+    }
+  }
+}
+
+bool GlStateCache::skip(bool same)
+{
+  ++(same ? skipped : issued);
+  return same;
+}
+
+std::size_t GlStateCache::dimension_index(GLenum dimension) const
+{
+  return dimension == GL_TEXTURE_1D ? 0 : dimension == GL_TEXTURE_2D ? 1 : 2;
+}
+
+GlName::GlName(const char* name)
+  : _id(intern(name))
+{
+}
+
+GlName::GlName(const std::string& name)
+  : _id(intern(name))
+{
+}
+
+const std::string& GlName::get_name() const
+{
+  return get_name_table().names[_id];
+}
+
+std::size_t GlName::get_id() const
+{
+  return _id;
+}
+
+std::size_t GlName::intern(const std::string& name)
+{
+  name_table& table = get_name_table();
+  auto it = table.ids.find(name);
+  if (it != table.ids.end()) {
+    return it->second;
+  }
+  table.ids.emplace(name, table.names.size());
+  table.names.push_back(name);
+  return table.names.size() - 1;
+}
+
+const GLint GlProgram::unresolved;
+std::unordered_set<GLint> GlProgram::_divisor_attribute_indices;
+
 GlProgram::GlProgram()
   : GlHandle(0)
   , _texture_index(0)
+  , _variables(new variables)
 {
 }
 
 GlProgram::GlProgram(GLuint handle)
   : GlHandle(handle)
   , _texture_index(0)
+  , _variables(new variables)
 {
+  introspect(false);
+  introspect(true);
 }
 
 void GlProgram::bind() const
 {
-  glUseProgram(get_handle());
+  GlStateCache::use_program(get_handle());
   _texture_index = 0;
   // Disable all attribute arrays by default.
   for (GLint location : _enabled_attribute_indices) {
     glDisableVertexAttribArray(location);
   }
   _enabled_attribute_indices.clear();
+  for (GLint location : _divisor_attribute_indices) {
+    glVertexAttribDivisorARB(location, 0);
+  }
+  _divisor_attribute_indices.clear();
 }
 
-void GlProgram::unbind_attribute(const std::string& name) const
+void GlProgram::unbind_attribute(const GlName& name) const
 {
   GLint location = get_attribute_location(name);
   _enabled_attribute_indices.erase(location);
   glDisableVertexAttribArray(location);
 }
 
-bool GlProgram::bind_uniform(const std::string& name,
+bool GlProgram::bind_uniform(const GlName& name,
                              const GlFramebuffer& arg) const
 {
   arg.get_texture().bind(GL_TEXTURE0 + _texture_index);
   return bind_uniform(name, _texture_index++);
 }
 
-bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
+bool GlProgram::bind_uniform(std::size_t index, const GlName& name,
                              const GlFramebuffer& arg) const
 {
   arg.get_texture().bind(GL_TEXTURE0 + _texture_index);
@@ -182,18 +442,19 @@ bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
 
 #ifndef DEBUG
 bool GlProgram::check_match(
-    bool, const std::string&, bool, std::size_t, GLenum, std::size_t) const
+    bool, const GlName&, bool, std::size_t, GLenum, std::size_t) const
 {
   return true;
 }
 #else
-bool GlProgram::check_match(bool attribute, const std::string& name,
+bool GlProgram::check_match(bool attribute, const GlName& name,
                             bool array, std::size_t index,
                             GLenum type, std::size_t length) const
 {
   GLenum name_type;
   if (!check_name_exists(attribute, name, array, index, name_type)) {
-    logg_err("Undefined ", attribute ? "attribute" : "uniform", " ", name);
+    logg_err("Undefined ", attribute ? "attribute" : "uniform", " ",
+             name.get_name());
     if (array) {
       logg_err("[", index, "]");
     }
@@ -207,21 +468,34 @@ bool GlProgram::check_match(bool attribute, const std::string& name,
 
   if (type != name_base_type) {
     log_err(attribute ? "Attribute" : "Uniform",
-            " ", name, " given incorrect type");
+            " ", name.get_name(), " given incorrect type");
     return false;
   }
   if (length != name_length) {
     log_err(attribute ? "Attribute" : "Uniform",
-            " ", name, " given incorrect length");
+            " ", name.get_name(), " given incorrect length");
     return false;
   }
   return true;
 }
 #endif
 
-bool GlProgram::check_name_exists(bool attribute, const std::string& name,
+bool GlProgram::check_name_exists(bool attribute, const GlName& name,
                                   bool array, std::size_t index,
                                   GLenum& type_output) const
+{
+  const active_map& map =
+      attribute ? _variables->attributes : _variables->uniforms;
+  auto it = map.find(name.get_name());
+  if (it == map.end()) {
+    return false;
+  }
+  type_output = it->second.type;
+  return (!array && it->second.array_size == 1) ||
+      (array && signed(index) < it->second.array_size);
+}
+
+void GlProgram::introspect(bool attribute) const
 {
   GLint name_count;
   glGetProgramiv(
@@ -234,75 +508,84 @@ bool GlProgram::check_name_exists(bool attribute, const std::string& name,
       attribute ? GL_ACTIVE_ATTRIBUTE_MAX_LENGTH : GL_ACTIVE_UNIFORM_MAX_LENGTH,
       &name_length);
 
+  active_map& map = attribute ? _variables->attributes : _variables->uniforms;
   std::unique_ptr<char[]> buffer(new char[name_length]);
-  GLint array_size;
   for (GLint i = 0; i < name_count; ++i) {
+    active_variable v;
     if (attribute) {
       glGetActiveAttrib(get_handle(), i, name_length, nullptr,
-                        &array_size, &type_output, buffer.get());
+                        &v.array_size, &v.type, buffer.get());
+      v.location = glGetAttribLocation(get_handle(), buffer.get());
     }
     else {
       glGetActiveUniform(get_handle(), i, name_length, nullptr,
-                         &array_size, &type_output, buffer.get());
+                         &v.array_size, &v.type, buffer.get());
+      v.location = glGetUniformLocation(get_handle(), buffer.get());
     }
-    if (name == buffer.get() &&
-        ((!array && array_size == 1) ||
-         (array && signed(index) < array_size))) {
-      return true;
+
+    // Some implementations name arrays with the first element.
+    std::string name = buffer.get();
+    if (name.length() > 3 && name.substr(name.length() - 3) == "[0]") {
+      name = name.substr(0, name.length() - 3);
     }
+    map.emplace(name, v);
   }
-  return false;
 }
 
-GLint GlProgram::get_uniform_location(const std::string& name) const
+GLint GlProgram::get_location(bool attribute, const GlName& name) const
 {
-  auto it = _uniform_single_map.find(name);
-  if (it != _uniform_single_map.end()) {
-    return it->second;
+  std::vector<GLint>& locations = attribute ?
+      _variables->attribute_locations : _variables->uniform_locations;
+  if (name.get_id() >= locations.size()) {
+    locations.resize(1 + name.get_id(), unresolved);
+  }
+
+  GLint& location = locations[name.get_id()];
+  if (location == unresolved) {
+    const active_map& map =
+        attribute ? _variables->attributes : _variables->uniforms;
+    auto it = map.find(name.get_name());
+    location = it == map.end() ? -1 : it->second.location;
   }
-  GLint location = glGetUniformLocation(get_handle(), name.c_str());
-  _uniform_single_map.emplace(name, location);
   return location;
 }
 
-GLint GlProgram::get_uniform_location(const std::string& name,
+GLint GlProgram::get_uniform_location(const GlName& name) const
+{
+  return get_location(false, name);
+}
+
+GLint GlProgram::get_uniform_location(const GlName& name,
                                       std::size_t index) const
 {
-  auto p = std::make_pair(name, index);
-  auto it = _uniform_array_map.find(p);
-  if (it != _uniform_array_map.end()) {
+  auto p = std::make_pair(name.get_id(), index);
+  auto it = _variables->uniform_array_locations.find(p);
+  if (it != _variables->uniform_array_locations.end()) {
     return it->second;
   }
   std::stringstream n;
-  n << name << "[" << index << "]";
+  n << name.get_name() << "[" << index << "]";
   GLint location = glGetUniformLocation(get_handle(), n.str().c_str());
-  _uniform_array_map.emplace(p, location);
+  _variables->uniform_array_locations.emplace(p, location);
   return location;
 }
 
-GLint GlProgram::get_attribute_location(const std::string& name) const
+GLint GlProgram::get_attribute_location(const GlName& name) const
 {
-  auto it = _attribute_single_map.find(name);
-  if (it != _attribute_single_map.end()) {
-    return it->second;
-  }
-  GLint location = glGetAttribLocation(get_handle(), name.c_str());
-  _attribute_single_map.emplace(name, location);
-  return location;
+  return get_location(true, name);
 }
 
-GLint GlProgram::get_attribute_location(const std::string& name,
+GLint GlProgram::get_attribute_location(const GlName& name,
                                         std::size_t index) const
 {
-  auto p = std::make_pair(name, index);
-  auto it = _attribute_array_map.find(p);
-  if (it != _attribute_array_map.end()) {
+  auto p = std::make_pair(name.get_id(), index);
+  auto it = _variables->attribute_array_locations.find(p);
+  if (it != _variables->attribute_array_locations.end()) {
     return it->second;
   }
   std::stringstream n;
-  n << name << "[" << index << "]";
+  n << name.get_name() << "[" << index << "]";
   GLint location = glGetAttribLocation(get_handle(), n.str().c_str());
-  _attribute_array_map.emplace(p, location);
+  _variables->attribute_array_locations.emplace(p, location);
   return location;
 }
-
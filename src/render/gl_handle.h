@@ -2,6 +2,9 @@
 #define RENDER_GL_HANDLE_H
 
 #include "../vec.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -80,6 +83,83 @@ private:
 
 };
 
+// Shared state for streaming buffer uploads, owned by GlUtil. Buffers which
+// are uploaded repeatedly (anything not GL_STATIC_DRAW) are used as ring
+// buffers: each upload is written after the previous one through an
+// unsynchronised mapping, and the storage is orphaned when it runs out, so
+// the driver never has to reallocate or wait for draws using earlier data.
+struct GlStreamState {
+  GlStreamState();
+
+  // Smallest storage allocated for a streaming buffer, in bytes.
+  static const GLsizeiptr min_capacity = 1 << 16;
+
+  bool map_buffer_range;
+
+  // Statistics since the last reset.
+  std::size_t uploads;
+  std::size_t bytes;
+  std::size_t orphans;
+  std::size_t ns;
+};
+
+// Shadow copy of the GL state that handles change, owned by GlUtil, so that
+// calls which wouldn't change anything can be skipped. There's only ever one
+// context, so handles find the current cache through a global pointer; with no
+// GlUtil, every call goes straight to GL. Anything that changes this state must
+// go through here, and deleted objects must be forgotten, since GL reuses
+// names.
+class GlStateCache {
+public:
+
+  GlStateCache();
+  ~GlStateCache();
+
+  GlStateCache(const GlStateCache&) = delete;
+  GlStateCache& operator=(const GlStateCache&) = delete;
+
+  static void use_program(GLuint program);
+  static void bind_framebuffer(GLuint framebuffer);
+  static void viewport(const y::ivec2& size);
+  static void bind_buffer(GLenum target, GLuint buffer);
+  // Unit is GL_TEXTURE0 + i.
+  static void bind_texture(GLenum unit, GLenum dimension, GLuint texture);
+  static void enable(GLenum capability, bool enable);
+  static void depth_func(GLenum test);
+  static void blend_func(GLenum source, GLenum target);
+
+  static void forget_program(GLuint program);
+  static void forget_framebuffer(GLuint framebuffer);
+  static void forget_buffer(GLuint buffer);
+  static void forget_texture(GLuint texture);
+
+  // Statistics since the last reset.
+  std::size_t issued;
+  std::size_t skipped;
+
+private:
+
+  static const std::size_t max_texture_units = 32;
+  static const GLuint unknown = ~GLuint(0);
+  static GlStateCache* _current;
+
+  // Returns true if the call should be skipped, counting it either way.
+  bool skip(bool same);
+  std::size_t dimension_index(GLenum dimension) const;
+
+  GLuint _program;
+  GLuint _framebuffer;
+  y::ivec2 _viewport;
+  std::unordered_map<GLenum, GLuint> _buffers;
+  GLenum _active_texture;
+  GLuint _textures[max_texture_units][3];
+  std::unordered_map<GLenum, bool> _capabilities;
+  GLenum _depth_func;
+  GLenum _blend_source;
+  GLenum _blend_target;
+
+};
+
 // Lightweight handle to an OpenGL buffer.
 template<typename T, std::size_t>
 class GlBuffer : public GlHandle {
@@ -89,21 +169,36 @@ public:
   ~GlBuffer() override {}
 
   void bind() const;
-  void draw_elements(GLenum mode, GLsizei count) const;
+  // Offset is measured in elements from the start of the buffer.
+  void draw_elements(GLenum mode, GLsizei count, GLsizei offset = 0) const;
+  // Draw the elements repeatedly. Requires GlUtil::has_instancing().
+  void draw_elements_instanced(GLenum mode, GLsizei count, GLsizei instances,
+                               GLsizei offset = 0) const;
 
+  // Size is measured in bytes.
   void reupload_data(const T* data, GLsizei size) const;
   void reupload_data(const std::vector<T>& data) const;
 
+  // Byte offset of the most recently uploaded data within the buffer. This is
+  // taken into account automatically when binding or drawing.
+  GLintptr get_offset() const;
+
 protected:
 
   friend class GlUtil;
-  GlBuffer(GLuint handle, GLenum target, GLenum usage_hint);
+  GlBuffer(GLuint handle, GLenum target, GLenum usage_hint,
+           GlStreamState* stream);
 
 private:
 
   GLenum _target;
   GLenum _usage_hint;
 
+  GlStreamState* _stream;
+  mutable GLintptr _offset;
+  mutable GLintptr _end;
+  mutable GLsizeiptr _capacity;
+
 };
 
 // Lightweight handle to an OpenGL texture.
@@ -202,6 +297,27 @@ protected:
 
 };
 
+// Name of a uniform or attribute variable. Every distinct name is interned
+// with a small integer ID, which programs use to look up the location without
+// hashing the string. Constructing a name does hash it, so names used every
+// frame should be constructed once (e.g. at namespace scope) and reused.
+class GlName {
+public:
+
+  GlName(const char* name);
+  GlName(const std::string& name);
+
+  const std::string& get_name() const;
+  std::size_t get_id() const;
+
+private:
+
+  static std::size_t intern(const std::string& name);
+
+  std::size_t _id;
+
+};
+
 // Lightweight handle to a GLSL shader program.
 class GlProgram : public GlHandle {
 public:
@@ -213,67 +329,74 @@ public:
   void bind() const;
 
   // Unbind and disable an attribute.
-  void unbind_attribute(const std::string& name) const;
+  void unbind_attribute(const GlName& name) const;
 
   // Bind the value of an attribute variable.
   template<typename T, std::size_t N>
-  bool bind_attribute(const std::string& name,
+  bool bind_attribute(const GlName& name,
                       const GlBuffer<T, N>& buffer) const;
+  // Bind the value of an attribute variable to M components of each element
+  // of an interleaved buffer, starting at the given component offset. With a
+  // nonzero divisor, the attribute advances once per that many instances
+  // rather than once per vertex (requires GlUtil::has_instancing()).
+  template<std::size_t M, typename T, std::size_t N>
+  bool bind_attribute(const GlName& name, const GlBuffer<T, N>& buffer,
+                      std::size_t offset, GLuint divisor = 0) const;
 
   // Bind the value of a uniform variable.
   template<typename T>
-  bool bind_uniform(const std::string& name, T a) const;
+  bool bind_uniform(const GlName& name, T a) const;
   template<typename T>
-  bool bind_uniform(const std::string& name, T a, T b) const;
+  bool bind_uniform(const GlName& name, T a, T b) const;
   template<typename T>
-  bool bind_uniform(const std::string& name, T a, T b, T c) const;
+  bool bind_uniform(const GlName& name, T a, T b, T c) const;
   template<typename T>
-  bool bind_uniform(const std::string& name, T a, T b, T c, T d) const;
+  bool bind_uniform(const GlName& name, T a, T b, T c, T d) const;
 
   template<typename T>
-  bool bind_uniform(const std::string& name, const y::vec<T, 2>& arg) const;
+  bool bind_uniform(const GlName& name, const y::vec<T, 2>& arg) const;
   template<typename T>
-  bool bind_uniform(const std::string& name, const y::vec<T, 3>& arg) const;
+  bool bind_uniform(const GlName& name, const y::vec<T, 3>& arg) const;
   template<typename T>
-  bool bind_uniform(const std::string& name, const y::vec<T, 4>& arg) const;
+  bool bind_uniform(const GlName& name, const y::vec<T, 4>& arg) const;
 
-  bool bind_uniform(const std::string& name, const GlFramebuffer& arg) const;
+  bool bind_uniform(const GlName& name, const GlFramebuffer& arg) const;
   template<std::size_t N>
-  bool bind_uniform(const std::string& name, const GlTexture<N>& arg) const;
+  bool bind_uniform(const GlName& name, const GlTexture<N>& arg) const;
 
   // Bind the value of an attribute variable in an array.
   template<typename T, std::size_t N>
-  bool bind_attribute(std::size_t index, const std::string& name,
+  bool bind_attribute(std::size_t index, const GlName& name,
                       const GlBuffer<T, N>& buffer) const;
 
   // Bind the value of a uniform variable in an array.
   template<typename T>
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     T a) const;
   template<typename T>
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     T a, T b) const;
   template<typename T>
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     T a, T b, T c) const;
   template<typename T>
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     T a, T b, T c, T d) const;
 
   template<typename T>
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     const y::vec<T, 2>& arg) const;
   template<typename T>
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     const y::vec<T, 3>& arg) const;
   template<typename T>
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     const y::vec<T, 4>& arg) const;
 
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     const GlFramebuffer& arg) const;
   template<std::size_t N>
-  bool bind_uniform(std::size_t index, const std::string& name,
+  bool bind_uniform(std::size_t index, const GlName& name,
                     const GlTexture<N>& arg) const;
 
 protected:
@@ -284,36 +407,60 @@ protected:
 private:
 
   // Check if uniform or attribute name exists in program.
-  bool check_name_exists(bool attribute, const std::string& name,
+  bool check_name_exists(bool attribute, const GlName& name,
                          bool array, std::size_t index,
                          GLenum& type_output) const;
 
   // Check if name exists and has correct type and size, or print error message.
   // TODO: GL allows converting integer -> float, etc, so that should work.
-  bool check_match(bool attribute, const std::string& name,
+  bool check_match(bool attribute, const GlName& name,
                    bool array, std::size_t index,
                    GLenum type, std::size_t length) const;
 
-  typedef std::unordered_map<std::string, GLint> single_map;
-  typedef std::unordered_map<std::pair<std::string, std::size_t>, GLint> array_map;
-
-  mutable std::int32_t _texture_index;
+  struct active_variable {
+    GLenum type;
+    GLint array_size;
+    GLint location;
+  };
+  typedef std::unordered_map<std::string, active_variable> active_map;
+  typedef std::unordered_map<std::pair<std::size_t, std::size_t>,
+                             GLint> array_map;
+
+  // Everything we know about the variables of a linked program. This is
+  // shared between copies of the handle, so it's only found once.
+  struct variables {
+    // Filled in by introspection when the program is made. Array names are
+    // stored without any "[0]" suffix.
+    active_map uniforms;
+    active_map attributes;
+
+    // Locations indexed by name ID, filled in as they're used. Unused IDs
+    // have location unresolved.
+    std::vector<GLint> uniform_locations;
+    std::vector<GLint> attribute_locations;
+    array_map uniform_array_locations;
+    array_map attribute_array_locations;
+  };
+  static const GLint unresolved = -2;
 
-  mutable single_map _uniform_single_map;
-  mutable array_map _uniform_array_map;
+  void introspect(bool attribute) const;
+  GLint get_location(bool attribute, const GlName& name) const;
 
-  mutable single_map _attribute_single_map;
-  mutable array_map _attribute_array_map;
+  mutable std::int32_t _texture_index;
+  std::shared_ptr<variables> _variables;
 
-  GLint get_uniform_location(const std::string& name) const;
-  GLint get_uniform_location(const std::string& name, std::size_t index) const;
+  GLint get_uniform_location(const GlName& name) const;
+  GLint get_uniform_location(const GlName& name, std::size_t index) const;
 
-  GLint get_attribute_location(const std::string& name) const;
-  GLint get_attribute_location(const std::string& name, std::size_t index) const;
+  GLint get_attribute_location(const GlName& name) const;
+  GLint get_attribute_location(const GlName& name, std::size_t index) const;
 
   // Store which attributes are enabled so we can disable them when no longer
   // needed.
   mutable std::unordered_set<GLint> _enabled_attribute_indices;
+  // Attribute divisors aren't part of the program state, so these have to be
+  // reset whenever any program is bound.
+  static std::unordered_set<GLint> _divisor_attribute_indices;
 
 };
 
@@ -404,35 +551,98 @@ GlBuffer<T, N>::GlBuffer()
   : GlHandle(0)
   , _target(0)
   , _usage_hint(0)
+  , _stream(nullptr)
+  , _offset(0)
+  , _end(0)
+  , _capacity(0)
 {
 }
 
 template<typename T, std::size_t N>
-GlBuffer<T, N>::GlBuffer(GLuint handle, GLenum target, GLenum usage_hint)
+GlBuffer<T, N>::GlBuffer(GLuint handle, GLenum target, GLenum usage_hint,
+                         GlStreamState* stream)
   : GlHandle(handle)
   , _target(target)
   , _usage_hint(usage_hint)
+  , _stream(stream)
+  , _offset(0)
+  , _end(0)
+  , _capacity(0)
 {
 }
 
 template<typename T, std::size_t N>
 void GlBuffer<T, N>::bind() const
 {
-  glBindBuffer(_target, get_handle());
+  GlStateCache::bind_buffer(_target, get_handle());
+}
+
+template<typename T, std::size_t N>
+void GlBuffer<T, N>::draw_elements(
+    GLenum mode, GLsizei count, GLsizei offset) const
+{
+  bind();
+  glDrawElements(mode, N * count, GlType<T>::type_enum,
+                 (void*)(_offset + sizeof(T) * N * offset));
 }
 
 template<typename T, std::size_t N>
-void GlBuffer<T, N>::draw_elements(GLenum mode, GLsizei count) const
+void GlBuffer<T, N>::draw_elements_instanced(
+    GLenum mode, GLsizei count, GLsizei instances, GLsizei offset) const
 {
   bind();
-  glDrawElements(mode, N * count, GlType<T>::type_enum, (void*)0);
+  glDrawElementsInstancedARB(mode, N * count, GlType<T>::type_enum,
+                             (void*)(_offset + sizeof(T) * N * offset),
+                             instances);
 }
 
 template<typename T, std::size_t N>
 void GlBuffer<T, N>::reupload_data(const T* data, GLsizei size) const
 {
   bind();
-  glBufferData(_target, size, data, _usage_hint);
+  if (!_stream || !_stream->map_buffer_range ||
+      _usage_hint == GL_STATIC_DRAW) {
+    glBufferData(_target, size, data, _usage_hint);
+    _offset = 0;
+    _end = size;
+    _capacity = size;
+    return;
+  }
+
+  typedef std::chrono::steady_clock clock;
+  clock::time_point start = clock::now();
+
+  // Keep every upload aligned well enough for any vertex attribute.
+  GLintptr offset = (_end + 15) & ~GLintptr(15);
+  if (offset + size > _capacity) {
+    // Orphan the old storage. Draws still using it will finish with it, and
+    // we start again at the beginning of new storage.
+    _capacity = std::max(std::max(_capacity, GlStreamState::min_capacity),
+                         GLsizeiptr(4 * size));
+    glBufferData(_target, _capacity, nullptr, _usage_hint);
+    offset = 0;
+    ++_stream->orphans;
+  }
+
+  if (size) {
+    void* target = glMapBufferRange(
+        _target, offset, size, GL_MAP_WRITE_BIT |
+        GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (target) {
+      std::memcpy(target, data, size);
+      glUnmapBuffer(_target);
+    }
+    else {
+      glBufferSubData(_target, offset, size, data);
+    }
+  }
+  _offset = offset;
+  _end = offset + size;
+
+  ++_stream->uploads;
+  _stream->bytes += size;
+  _stream->ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+      clock::now() - start).count();
 }
 
 template<typename T, std::size_t N>
@@ -441,6 +651,12 @@ void GlBuffer<T, N>::reupload_data(const std::vector<T>& data) const
   reupload_data(data.data(), sizeof(T) * data.size());
 }
 
+template<typename T, std::size_t N>
+GLintptr GlBuffer<T, N>::get_offset() const
+{
+  return _offset;
+}
+
 template<std::size_t N>
 GlTexture<N>::GlTexture()
   : GlHandle(0)
@@ -457,8 +673,8 @@ GlTexture<N>::GlTexture(GLuint handle, const ivecn& size)
 template<std::size_t N>
 void GlTexture<N>::bind(GLenum target) const
 {
-  glActiveTexture(target);
-  glBindTexture(GlTextureEnum<N>::dimension_enum, get_handle());
+  GlStateCache::bind_texture(
+      target, GlTextureEnum<N>::dimension_enum, get_handle());
 }
 
 template<std::size_t N>
@@ -468,7 +684,7 @@ const typename GlTexture<N>::ivecn& GlTexture<N>::get_size() const
 }
 
 template<typename T, std::size_t N>
-bool GlProgram::bind_attribute(const std::string& name,
+bool GlProgram::bind_attribute(const GlName& name,
                                const GlBuffer<T, N>& buffer) const
 {
   if (!check_match(true, name, false, 0, GlType<T>::type_enum, N)) {
@@ -480,12 +696,36 @@ bool GlProgram::bind_attribute(const std::string& name,
   glEnableVertexAttribArray(location);
   buffer.bind();
   glVertexAttribPointer(
-      location, N, GlType<T>::type_enum, GL_FALSE, sizeof(T) * N, nullptr);
+      location, N, GlType<T>::type_enum, GL_FALSE, sizeof(T) * N,
+      (void*)buffer.get_offset());
+  return true;
+}
+
+template<std::size_t M, typename T, std::size_t N>
+bool GlProgram::bind_attribute(const GlName& name,
+                               const GlBuffer<T, N>& buffer,
+                               std::size_t offset, GLuint divisor) const
+{
+  if (!check_match(true, name, false, 0, GlType<T>::type_enum, M)) {
+    return false;
+  }
+
+  GLint location = get_attribute_location(name);
+  _enabled_attribute_indices.insert(location);
+  glEnableVertexAttribArray(location);
+  buffer.bind();
+  glVertexAttribPointer(
+      location, M, GlType<T>::type_enum, GL_FALSE, sizeof(T) * N,
+      (void*)(buffer.get_offset() + sizeof(T) * offset));
+  if (divisor) {
+    _divisor_attribute_indices.insert(location);
+    glVertexAttribDivisorARB(location, divisor);
+  }
   return true;
 }
 
 template<typename T>
-bool GlProgram::bind_uniform(const std::string& name, T a) const
+bool GlProgram::bind_uniform(const GlName& name, T a) const
 {
   if (!check_match(false, name, false, 0, GlType<T>::type_enum, 1)) {
     return false;
@@ -497,7 +737,7 @@ bool GlProgram::bind_uniform(const std::string& name, T a) const
 }
 
 template<typename T>
-bool GlProgram::bind_uniform(const std::string& name, T a, T b) const
+bool GlProgram::bind_uniform(const GlName& name, T a, T b) const
 {
   if (!check_match(false, name, false, 0, GlType<T>::type_enum, 2)) {
     return false;
@@ -509,7 +749,7 @@ bool GlProgram::bind_uniform(const std::string& name, T a, T b) const
 }
 
 template<typename T>
-bool GlProgram::bind_uniform(const std::string& name, T a, T b, T c) const
+bool GlProgram::bind_uniform(const GlName& name, T a, T b, T c) const
 {
   if (!check_match(false, name, false, 0, GlType<T>::type_enum, 3)) {
     return false;
@@ -521,7 +761,7 @@ bool GlProgram::bind_uniform(const std::string& name, T a, T b, T c) const
 }
 
 template<typename T>
-bool GlProgram::bind_uniform(const std::string& name, T a, T b, T c, T d) const
+bool GlProgram::bind_uniform(const GlName& name, T a, T b, T c, T d) const
 {
   if (!check_match(false, name, false, 0, GlType<T>::type_enum, 4)) {
     return false;
@@ -534,27 +774,27 @@ bool GlProgram::bind_uniform(const std::string& name, T a, T b, T c, T d) const
 
 template<typename T>
 bool GlProgram::bind_uniform(
-    const std::string& name, const y::vec<T, 2>& arg) const
+    const GlName& name, const y::vec<T, 2>& arg) const
 {
   return bind_uniform(name, arg[xx], arg[yy]);
 }
 
 template<typename T>
 bool GlProgram::bind_uniform(
-    const std::string& name, const y::vec<T, 3>& arg) const
+    const GlName& name, const y::vec<T, 3>& arg) const
 {
   return bind_uniform(name, arg[xx], arg[yy], arg[zz]);
 }
 
 template<typename T>
 bool GlProgram::bind_uniform(
-    const std::string& name, const y::vec<T, 4>& arg) const
+    const GlName& name, const y::vec<T, 4>& arg) const
 {
   return bind_uniform(name, arg[xx], arg[yy], arg[zz], arg[ww]);
 }
 
 template<std::size_t N>
-bool GlProgram::bind_uniform(const std::string& name,
+bool GlProgram::bind_uniform(const GlName& name,
                              const GlTexture<N>& arg) const
 {
   arg.bind(GL_TEXTURE0 + _texture_index);
@@ -562,7 +802,7 @@ bool GlProgram::bind_uniform(const std::string& name,
 }
 
 template<typename T, std::size_t N>
-bool GlProgram::bind_attribute(std::size_t index, const std::string& name,
+bool GlProgram::bind_attribute(std::size_t index, const GlName& name,
                                const GlBuffer<T, N>& buffer) const
 {
   if (!check_match(true, name, true, index, GlType<T>::type_enum, N)) {
@@ -574,12 +814,13 @@ bool GlProgram::bind_attribute(std::size_t index, const std::string& name,
   glEnableVertexAttribArray(location);
   buffer.bind();
   glVertexAttribPointer(
-      location, N, GlType<T>::type_enum, GL_FALSE, sizeof(T) * N, nullptr);
+      location, N, GlType<T>::type_enum, GL_FALSE, sizeof(T) * N,
+      (void*)buffer.get_offset());
   return true;
 }
 
 template<typename T>
-bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
+bool GlProgram::bind_uniform(std::size_t index, const GlName& name,
                              T a) const
 {
   if (!check_match(false, name, true, index, GlType<T>::type_enum, 1)) {
@@ -592,7 +833,7 @@ bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
 }
 
 template<typename T>
-bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
+bool GlProgram::bind_uniform(std::size_t index, const GlName& name,
                              T a, T b) const
 {
   if (!check_match(false, name, true, index, GlType<T>::type_enum, 2)) {
@@ -605,7 +846,7 @@ bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
 }
 
 template<typename T>
-bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
+bool GlProgram::bind_uniform(std::size_t index, const GlName& name,
                              T a, T b, T c) const
 {
   if (!check_match(false, name, true, index, GlType<T>::type_enum, 3)) {
@@ -618,7 +859,7 @@ bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
 }
 
 template<typename T>
-bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
+bool GlProgram::bind_uniform(std::size_t index, const GlName& name,
                              T a, T b, T c, T d) const
 {
   if (!check_match(false, name, true, index, GlType<T>::type_enum, 4)) {
@@ -632,27 +873,27 @@ bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
 
 template<typename T>
 bool GlProgram::bind_uniform(
-    std::size_t index, const std::string& name, const y::vec<T, 2>& arg) const
+    std::size_t index, const GlName& name, const y::vec<T, 2>& arg) const
 {
   return bind_uniform(index, name, arg[xx], arg[yy]);
 }
 
 template<typename T>
 bool GlProgram::bind_uniform(
-    std::size_t index, const std::string& name, const y::vec<T, 3>& arg) const
+    std::size_t index, const GlName& name, const y::vec<T, 3>& arg) const
 {
   return bind_uniform(index, name, arg[xx], arg[yy], arg[zz]);
 }
 
 template<typename T>
 bool GlProgram::bind_uniform(
-    std::size_t index, const std::string& name, const y::vec<T, 4>& arg) const
+    std::size_t index, const GlName& name, const y::vec<T, 4>& arg) const
 {
   return bind_uniform(index, name, arg[xx], arg[yy], arg[zz], arg[ww]);
 }
 
 template<std::size_t N>
-bool GlProgram::bind_uniform(std::size_t index, const std::string& name,
+bool GlProgram::bind_uniform(std::size_t index, const GlName& name,
                              const GlTexture<N>& arg) const
 {
   arg.bind(GL_TEXTURE0 + _texture_index);
@@ -7,6 +7,7 @@
 
 GlUtil::GlUtil(const Filesystem& filesystem, const Window& window)
   : _setup_ok(false)
+  , _instancing(false)
   , _filesystem(filesystem)
   , _window(window)
 {
@@ -44,6 +45,12 @@ GlUtil::GlUtil(const Filesystem& filesystem, const Window& window)
     return;
   }
 
+  // Instancing is core in 3.3 and widely available as extensions before that,
+  // but isn't required.
+  _instancing = GLEW_ARB_instanced_arrays && GLEW_ARB_draw_instanced;
+  log_debug("Instanced drawing ", _instancing ? "available" : "unavailable");
+  _stream.map_buffer_range = GLEW_ARB_map_buffer_range;
+
   std::vector<std::string> shaders;
   _filesystem.list_pattern(shaders, "/shaders/**.v.glsl");
   _filesystem.list_pattern(shaders, "/shaders/**.f.glsl");
@@ -90,12 +97,41 @@ const Window& GlUtil::get_window() const
   return _window;
 }
 
+bool GlUtil::has_instancing() const
+{
+  return _instancing;
+}
+
+const GlStreamState& GlUtil::get_stream_stats() const
+{
+  return _stream;
+}
+
+void GlUtil::reset_stream_stats()
+{
+  _stream.uploads = 0;
+  _stream.bytes = 0;
+  _stream.orphans = 0;
+  _stream.ns = 0;
+}
+
+const GlStateCache& GlUtil::get_state_stats() const
+{
+  return _state;
+}
+
+void GlUtil::reset_state_stats()
+{
+  _state.issued = 0;
+  _state.skipped = 0;
+}
+
 GlFramebuffer GlUtil::make_framebuffer(const y::ivec2& size,
                                        bool has_alpha, bool has_depth)
 {
   GLuint framebuffer;
   glGenFramebuffers(1, &framebuffer);
-  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+  GlStateCache::bind_framebuffer(framebuffer);
 
   GlTexture2D texture(make_texture<GLubyte>(size,
                                             has_alpha ? GL_RGBA8 : GL_RGB,
@@ -125,6 +161,7 @@ GlFramebuffer GlUtil::make_framebuffer(const y::ivec2& size,
   if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
     log_err("Framebuffer isn't complete");
     delete_texture(texture);
+    GlStateCache::forget_framebuffer(framebuffer);
     glDeleteFramebuffers(1, &framebuffer);
     if (has_depth) {
       glDeleteRenderbuffers(1, &depth);
@@ -149,6 +186,7 @@ void GlUtil::delete_framebuffer(const GlFramebuffer& framebuffer)
 {
   auto it = _framebuffer_set.find(framebuffer.get_handle());
   if (it != _framebuffer_set.end()) {
+    GlStateCache::forget_framebuffer(*it);
     glDeleteFramebuffers(1, &*it);
     _framebuffer_set.erase(it);
   }
@@ -195,6 +233,7 @@ GlTexture2D GlUtil::make_texture(const std::string& filename, bool loop)
   auto it = _texture_map.find(filename);
   if (it != _texture_map.end()) {
     GLuint handle = it->second.get_handle();
+    GlStateCache::forget_texture(handle);
     glDeleteTextures(1, &handle);
     _texture_map.erase(it);
   }
@@ -223,6 +262,7 @@ void GlUtil::delete_texture(const std::string& filename)
   log_debug("Deleting ", it->second.get_size()[xx], 'x',
             it->second.get_size()[yy], " texture ", it->first);
   GLuint handle = it->second.get_handle();
+  GlStateCache::forget_texture(handle);
   glDeleteTextures(1, &handle);
   auto jt = _texture_set.find(it->second.get_handle());
   if (jt != _texture_set.end()) {
@@ -339,6 +379,7 @@ GlProgram GlUtil::make_program(const std::vector<std::string>& shaders)
   if (ok) {
     auto it = _program_map.find(hash);
     if (it != _program_map.end()) {
+      GlStateCache::forget_program(it->second.get_handle());
       glDeleteProgram(it->second.get_handle());
       _program_map.erase(it);
     }
@@ -392,6 +433,7 @@ void GlUtil::delete_program(const std::vector<std::string>& shaders)
   auto it = _program_map.find(hash);
   if (it != _program_map.end()) {
     log_debug("Deleting program ", hash);
+    GlStateCache::forget_program(it->second.get_handle());
     glDeleteProgram(it->second.get_handle());
     _program_map.erase(it);
   }
@@ -402,6 +444,7 @@ void GlUtil::delete_program(const GlProgram& program)
   for (auto it = _program_map.begin(); it != _program_map.end(); ++it) {
     if (it->second.get_handle() == program.get_handle()) {
       log_debug("Deleting program ", it->first);
+      GlStateCache::forget_program(it->second.get_handle());
       glDeleteProgram(it->second.get_handle());
       _program_map.erase(it);
       break;
@@ -411,9 +454,8 @@ void GlUtil::delete_program(const GlProgram& program)
 
 void GlUtil::bind_window(bool clear, bool clear_depth) const
 {
-  glBindFramebuffer(GL_FRAMEBUFFER, 0);
-  const Resolution& mode = _window.get_mode();
-  glViewport(0, 0, mode.size[xx], mode.size[yy]);
+  GlStateCache::bind_framebuffer(0);
+  GlStateCache::viewport(_window.get_mode().size);
   glClearColor(0.f, 0.f, 0.f, 0.f);
   glClearDepth(1.f);
   glClear((GL_COLOR_BUFFER_BIT * clear) | (GL_DEPTH_BUFFER_BIT * clear_depth));
@@ -421,24 +463,18 @@ void GlUtil::bind_window(bool clear, bool clear_depth) const
 
 void GlUtil::enable_depth(bool depth, GLenum test) const
 {
+  // The depth range is never changed from the default of [0, 1].
+  GlStateCache::enable(GL_DEPTH_TEST, depth);
   if (depth) {
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(test);
-    glDepthRange(0.f, 1.f);
-  }
-  else {
-    glDisable(GL_DEPTH_TEST);
+    GlStateCache::depth_func(test);
   }
 }
 
 void GlUtil::enable_blend(bool blend, GLenum source, GLenum target) const
 {
+  GlStateCache::enable(GL_BLEND, blend);
   if (blend) {
-    glEnable(GL_BLEND);
-    glBlendFunc(source, target);
-  }
-  else {
-    glDisable(GL_BLEND);
+    GlStateCache::blend_func(source, target);
   }
 }
 
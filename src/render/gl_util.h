@@ -25,6 +25,16 @@ public:
 
   const Window& get_window() const;
 
+  // Returns true iff instanced drawing and attribute divisors are available.
+  bool has_instancing() const;
+
+  // Statistics for streaming buffer uploads.
+  const GlStreamState& get_stream_stats() const;
+  void reset_stream_stats();
+  // Statistics for state changes made or skipped by the state cache.
+  const GlStateCache& get_state_stats() const;
+  void reset_state_stats();
+
   // Make an OpenGL buffer.
   template<typename T, std::size_t N>
   GlBuffer<T, N> make_buffer(GLenum target, GLenum usage_hint);
@@ -117,6 +127,9 @@ public:
 private:
 
   bool _setup_ok;
+  bool _instancing;
+  GlStreamState _stream;
+  GlStateCache _state;
 
   const Filesystem& _filesystem;
   const Window& _window;
@@ -194,7 +207,7 @@ GlBuffer<T, N> GlUtil::make_buffer(GLenum target, GLenum usage_hint)
   glGenBuffers(1, &buffer);
 
   _buffer_set.insert(buffer);
-  return GlBuffer<T, N>(buffer, target, usage_hint);
+  return GlBuffer<T, N>(buffer, target, usage_hint, &_stream);
 }
 
 template<typename T, std::size_t N>
@@ -254,7 +267,7 @@ GlTexture<N> GlUtil::make_texture(const typename GlTexture<N>::ivecn& size,
 
   GLuint texture;
   glGenTextures(1, &texture);
-  glBindTexture(dimension, texture);
+  GlStateCache::bind_texture(GL_TEXTURE0, dimension, texture);
   glTexParameteri(dimension, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
   glTexParameteri(dimension, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
   glTexParameteri(dimension, GL_TEXTURE_WRAP_S, wrap_type);
@@ -279,6 +292,7 @@ void GlUtil::delete_buffer(const GlBuffer<T, N>& buffer)
 {
   auto it = _buffer_set.find(buffer._handle);
   if (it != _buffer_set.end()) {
+    GlStateCache::forget_buffer(*it);
     glDeleteBuffers(1, &*it);
     _buffer_set.erase(it);
   }
@@ -298,6 +312,7 @@ void GlUtil::delete_texture(const GlTexture<N>& texture)
 
   auto it = _texture_set.find(texture.get_handle());
   if (it != _texture_set.end()) {
+    GlStateCache::forget_texture(*it);
     glDeleteTextures(1, &*it);
     _texture_set.erase(it);
   }
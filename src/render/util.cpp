@@ -1,18 +1,75 @@
 #include "util.h"
 #include "gl_util.h"
 
+#include "../data/tileset.h"
+
 #include <boost/functional/hash.hpp>
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+typedef std::chrono::high_resolution_clock hrclock;
+
+// Map a float to an unsigned integer with the same ordering.
+std::uint32_t float_order(float f)
+{
+  std::uint32_t u;
+  std::memcpy(&u, &f, sizeof(u));
+  return u & 0x80000000 ? ~u : u | 0x80000000;
+}
+
+}
+
+RenderBatch::sheet RenderBatch::texture_sheet(const GlTexture2D& texture)
+{
+  return sheet{texture, y::ivec2(), texture.get_size()};
+}
+
+RenderBatch::sheet RenderBatch::sprite_sheet(const Sprite& sprite, bool normal)
+{
+  if (!sprite.atlas_texture.get_handle()) {
+    return texture_sheet(normal ? sprite.normal : sprite.texture);
+  }
+  return sheet{normal ? sprite.atlas_normal : sprite.atlas_texture,
+               sprite.atlas_origin, sprite.texture.get_size()};
+}
+
+RenderBatch::batched_sprite RenderBatch::make_sprite(
+    const sheet& sheet, const y::ivec2& frame_size,
+    const y::fvec2& origin, const y::ivec2& frame,
+    float depth, float rotation, const y::fvec4& colour)
+{
+  return batched_sprite{
+      origin[xx], origin[yy], float(frame[xx]), float(frame[yy]),
+      depth, rotation, colour,
+      float(frame_size[xx]), float(frame_size[yy]),
+      float(sheet.origin[xx]), float(sheet.origin[yy]),
+      float(sheet.size[xx]), float(sheet.size[yy])};
+}
+
+void RenderBatch::add_sprite(
+    const sheet& sheet, const y::ivec2& frame_size, bool normal,
+    const y::fvec2& origin, const y::ivec2& frame,
+    float depth, float rotation, const y::fvec4& colour)
+{
+  if (!(frame_size >= y::ivec2())) {
+    return;
+  }
+  _keys.push_back(sort_entry{make_key(sheet.texture, normal, depth),
+                             std::uint32_t(_sprites.size())});
+  _textures.push_back(sheet.texture);
+  _sprites.push_back(make_sprite(
+      sheet, frame_size, origin, frame, depth, rotation, colour));
+}
 
 void RenderBatch::add_sprite(
     const GlTexture2D& sprite, const y::ivec2& frame_size, bool normal,
     const y::fvec2& origin, const y::ivec2& frame,
     float depth, float rotation, const y::fvec4& colour)
 {
-  batched_texture bt{sprite, frame_size, normal};
-  batched_sprite bs{origin[xx], origin[yy],
-                    float(frame[xx]), float(frame[yy]),
-                    depth, rotation, colour};
-  _map[bt].push_back(bs);
+  add_sprite(texture_sheet(sprite), frame_size, normal,
+             origin, frame, depth, rotation, colour);
 }
 
 void RenderBatch::iadd_sprite(
@@ -24,40 +81,87 @@ void RenderBatch::iadd_sprite(
              y::fvec2(origin), frame, depth, 0.f, colour);
 }
 
-bool RenderBatch::batched_texture_order::operator()(
-    const batched_texture& l, const batched_texture& r) const
+void RenderBatch::sort()
 {
-  if (l.sprite.get_handle() < r.sprite.get_handle()) {
-    return true;
-  }
-  if (l.sprite.get_handle() > r.sprite.get_handle()) {
-    return false;
-  }
-  if (l.frame_size[xx] < r.frame_size[xx]) {
-    return true;
-  }
-  if (l.frame_size[xx] > r.frame_size[xx]) {
-    return false;
+  _sorted.clear();
+  _runs.clear();
+  if (_keys.empty()) {
+    return;
   }
-  if (l.frame_size[yy] < r.frame_size[yy]) {
-    return true;
+
+  // Least-significant-byte radix sort, which is stable, so sprites with equal
+  // keys stay in the order they were added. Bytes which are the same in every
+  // key (usually most of the texture handle) are skipped.
+  _scratch.resize(_keys.size());
+  for (std::size_t shift = 0; shift < 64; shift += 8) {
+    std::size_t offsets[256] = {0};
+    for (const sort_entry& e : _keys) {
+      ++offsets[(e.key >> shift) & 0xff];
+    }
+    if (offsets[(_keys[0].key >> shift) & 0xff] == _keys.size()) {
+      continue;
+    }
+    std::size_t total = 0;
+    for (std::size_t& offset : offsets) {
+      std::size_t count = offset;
+      offset = total;
+      total += count;
+    }
+    for (const sort_entry& e : _keys) {
+      _scratch[offsets[(e.key >> shift) & 0xff]++] = e;
+    }
+    _keys.swap(_scratch);
   }
-  if (l.frame_size[yy] > r.frame_size[yy]) {
-    return false;
+
+  // Everything above the depth is the same within a run.
+  for (std::size_t i = 0; i < _keys.size(); ++i) {
+    const sort_entry& e = _keys[i];
+    if (!i || (e.key >> 31) != (_keys[i - 1].key >> 31)) {
+      bool normal = (e.key >> 31) & 1;
+      _runs.push_back(
+          texture_run{batched_texture{_textures[e.index], normal}, i, 0});
+    }
+    ++_runs.back().count;
+    _sorted.push_back(_sprites[e.index]);
   }
-  return (l.normal ? 1 : 0) < (r.normal ? 1 : 0);
 }
 
-const RenderBatch::batched_texture_map& RenderBatch::get_map() const
+const RenderBatch::texture_run_list& RenderBatch::get_runs() const
+{
+  return _runs;
+}
+
+const RenderBatch::batched_sprite_list& RenderBatch::get_sorted_sprites() const
 {
-  return _map;
+  return _sorted;
 }
 
 void RenderBatch::clear()
 {
-  for (auto& pair : _map) {
-    pair.second.clear();
-  }
+  _keys.clear();
+  _textures.clear();
+  _sprites.clear();
+  _sorted.clear();
+  _runs.clear();
+}
+
+std::uint64_t RenderBatch::make_key(const GlTexture2D& texture, bool normal,
+                                    float depth)
+{
+  return std::uint64_t(texture.get_handle()) << 32 |
+      std::uint64_t(normal) << 31 | (0x7fffffff - (float_order(depth) >> 1));
+}
+
+const std::size_t BatchBuffer::sprite_components;
+const std::size_t BatchBuffer::vertex_components;
+
+BatchBuffer::BatchBuffer(GlUtil& gl, GLenum usage_hint)
+  : instance(gl.make_unique_buffer<float, sprite_components>(
+        GL_ARRAY_BUFFER, usage_hint))
+  , vertex(gl.make_unique_buffer<float, vertex_components>(
+        GL_ARRAY_BUFFER, usage_hint))
+  , length(0)
+{
 }
 
 static const GLushort quad_element_data[] = {0, 1, 2, 3};
@@ -67,6 +171,41 @@ static const float quad_vertex_data[] = {
   -1.f, +1.f,
    1.f, +1.f};
 
+namespace {
+
+// Names bound for every batch, so they're only interned once.
+const GlName resolution_name("resolution");
+const GlName translation_name("translation");
+const GlName scale_name("scale");
+const GlName corner_name("corner");
+const GlName origin_name("origin");
+const GlName frame_index_name("frame_index");
+const GlName rotation_name("rotation");
+const GlName depth_name("depth");
+const GlName colour_name("colour");
+const GlName frame_size_name("frame_size");
+const GlName sheet_name("sheet");
+const GlName sprite_name("sprite");
+const GlName sprite_size_name("sprite_size");
+const GlName normal_name("normal");
+
+// Bind the sprite attributes of an interleaved BatchBuffer element.
+template<std::size_t N>
+void bind_sprite_attributes(const GlProgram& program,
+                            const GlBuffer<float, N>& buffer,
+                            std::size_t offset, GLuint divisor)
+{
+  program.bind_attribute<2>(origin_name, buffer, offset, divisor);
+  program.bind_attribute<2>(frame_index_name, buffer, 2 + offset, divisor);
+  program.bind_attribute<1>(rotation_name, buffer, 4 + offset, divisor);
+  program.bind_attribute<1>(depth_name, buffer, 5 + offset, divisor);
+  program.bind_attribute<4>(colour_name, buffer, 6 + offset, divisor);
+  program.bind_attribute<2>(frame_size_name, buffer, 10 + offset, divisor);
+  program.bind_attribute<4>(sheet_name, buffer, 12 + offset, divisor);
+}
+
+}
+
 const y::ivec2 RenderUtil::native_size{RenderUtil::native_width,
                                        RenderUtil::native_height};
 // The size of the buffer we draw in order to handle rotations and other
@@ -97,18 +236,7 @@ RenderUtil::RenderUtil(GlUtil& gl)
   , _sprite_program(gl.make_unique_program({
         "/shaders/sprite.v.glsl",
         "/shaders/sprite.f.glsl"}))
-  , _pixels(gl.make_unique_buffer<float, 2>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _rotation(gl.make_unique_buffer<float, 1>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _origin(gl.make_unique_buffer<float, 2>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _frame_index(gl.make_unique_buffer<float, 2>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _depth(gl.make_unique_buffer<float, 1>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
-  , _colour(gl.make_unique_buffer<float, 4>(
-        GL_ARRAY_BUFFER, GL_STREAM_DRAW))
+  , _batch(gl, GL_STREAM_DRAW)
   , _element(gl.make_unique_buffer<GLushort, 1>(
         GL_ELEMENT_ARRAY_BUFFER, GL_DYNAMIC_DRAW))
 {
@@ -365,69 +493,29 @@ void RenderUtil::irender_outline(const y::ivec2& origin, const y::ivec2& size,
 }
 
 void RenderUtil::render_batch(
-    const GlTexture2D& sprite, const y::ivec2& frame_size, bool normal,
-    const RenderBatch::batched_sprite_list& list) const
+    const GlTexture2D& sprite, bool normal,
+    const RenderBatch::batched_sprite* sprites, std::size_t count) const
 {
-  if (!(_native_size >= y::ivec2()) ||
-      !(frame_size >= y::ivec2()) || list.empty()) {
+  if (!(_native_size >= y::ivec2()) || !count) {
     return;
   }
-  _gl.enable_depth(true);
-  _gl.enable_blend(true);
-
-  std::size_t length = list.size();
-  for (std::size_t i = 0; i < length; ++i) {
-    const RenderBatch::batched_sprite& s = list[i];
-    float left = s.left;
-    float top = s.top;
-
-    // Vertex attribute divisor buffers would be nice for this kind of thing,
-    // but it's not available until around OpenGL 4.3 which is kind of recent
-    // to target.
-    write_vector<float, std::vector<std::int32_t>>(_pixels.data, 8 * i, {
-        -frame_size[xx] / 2, -frame_size[yy] / 2,
-        frame_size[xx] / 2, -frame_size[yy] / 2,
-        -frame_size[xx] / 2, frame_size[yy] / 2,
-        frame_size[xx] / 2, frame_size[yy] / 2});
-    write_vector<float, std::vector<float>>(_rotation.data, 4 * i, {
-        s.rotation, s.rotation, s.rotation, s.rotation});
-    write_vector<float, std::vector<float>>(_origin.data, 8 * i, {
-        left, top, left, top,
-        left, top, left, top});
-    write_vector<float, std::vector<float>>(_frame_index.data, 8 * i, {
-        s.frame_x, s.frame_y, s.frame_x, s.frame_y,
-        s.frame_x, s.frame_y, s.frame_x, s.frame_y});
-    write_vector<float, std::vector<float>>(_depth.data, 4 * i, {
-        s.depth, s.depth, s.depth, s.depth});
-    write_vector<float, std::vector<float>>(_colour.data, 16 * i, {
-        s.colour[rr], s.colour[gg], s.colour[bb], s.colour[aa],
-        s.colour[rr], s.colour[gg], s.colour[bb], s.colour[aa],
-        s.colour[rr], s.colour[gg], s.colour[bb], s.colour[aa],
-        s.colour[rr], s.colour[gg], s.colour[bb], s.colour[aa]});
-  }
-
-  _sprite_program->bind();
-  _sprite_program->bind_attribute("pixels", _pixels.reupload());
-  _sprite_program->bind_attribute("rotation", _rotation.reupload());
-  _sprite_program->bind_attribute("origin", _origin.reupload());
-  _sprite_program->bind_attribute("frame_index", _frame_index.reupload());
-  _sprite_program->bind_attribute("depth", _depth.reupload());
-  _sprite_program->bind_attribute("colour", _colour.reupload());
-
-  y::ivec2 v = sprite.get_size() / frame_size;
-  _sprite_program->bind_uniform("sprite", sprite);
-  _sprite_program->bind_uniform("frame_size", frame_size);
-  _sprite_program->bind_uniform("frame_count", v);
-  _sprite_program->bind_uniform("normal", normal);
-  bind_pixel_uniforms(*_sprite_program);
-  quad_element(length).buffer->draw_elements(GL_TRIANGLES, 6 * length);
+  write_batch(_batch, sprites, count);
+  render_batch(sprite, normal, _batch);
 }
 
-void RenderUtil::render_batch(const RenderBatch& batch) const
+void RenderUtil::render_batch(RenderBatch& batch) const
 {
-  for (const auto& pair : batch.get_map()) {
-    render_batch(pair.first.sprite, pair.first.frame_size,
-                 pair.first.normal, pair.second);
+  hrclock::time_point start = hrclock::now();
+  batch.sort();
+  _batch_stats.sort_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+      hrclock::now() - start).count();
+
+  const RenderBatch::batched_sprite_list& sprites = batch.get_sorted_sprites();
+  _batch_stats.sprites += sprites.size();
+  _batch_stats.batches += batch.get_runs().size();
+  for (const RenderBatch::texture_run& run : batch.get_runs()) {
+    render_batch(run.texture.sprite, run.texture.normal,
+                 &sprites[run.first], run.count);
   }
 }
 
@@ -451,6 +539,96 @@ void RenderUtil::irender_sprite(
                 y::fvec2(origin), frame, depth, 0.f, colour);
 }
 
+void RenderUtil::write_batch(
+    BatchBuffer& buffer, const RenderBatch::batched_sprite_list& list) const
+{
+  write_batch(buffer, list.data(), list.size());
+}
+
+void RenderUtil::write_batch(
+    BatchBuffer& buffer, const RenderBatch::batched_sprite* sprites,
+    std::size_t count) const
+{
+  // Corner positions come from the shared quad vertex buffer when instancing,
+  // so each sprite is only written once. Otherwise, write each sprite out for
+  // every corner.
+  bool instanced = _gl.has_instancing();
+  std::size_t corners = instanced ? 1 : 4;
+  std::vector<float>& data =
+      instanced ? buffer.instance.data : buffer.vertex.data;
+  data.resize(count * corners * (instanced ?
+      BatchBuffer::sprite_components : BatchBuffer::vertex_components));
+
+  float* p = data.data();
+  for (std::size_t n = 0; n < count; ++n) {
+    const RenderBatch::batched_sprite& s = sprites[n];
+    for (std::size_t i = 0; i < corners; ++i) {
+      if (!instanced) {
+        *p++ = quad_vertex_data[2 * i];
+        *p++ = quad_vertex_data[1 + 2 * i];
+      }
+      *p++ = s.left;
+      *p++ = s.top;
+      *p++ = s.frame_x;
+      *p++ = s.frame_y;
+      *p++ = s.rotation;
+      *p++ = s.depth;
+      *p++ = s.colour[rr];
+      *p++ = s.colour[gg];
+      *p++ = s.colour[bb];
+      *p++ = s.colour[aa];
+      *p++ = s.frame_width;
+      *p++ = s.frame_height;
+      *p++ = s.sheet_left;
+      *p++ = s.sheet_top;
+      *p++ = s.sheet_width;
+      *p++ = s.sheet_height;
+    }
+  }
+
+  if (instanced) {
+    buffer.instance.reupload();
+  }
+  else {
+    buffer.vertex.reupload();
+  }
+  buffer.length = count;
+}
+
+void RenderUtil::render_batch(const GlTexture2D& sprite, bool normal,
+                              const BatchBuffer& buffer) const
+{
+  if (!(_native_size >= y::ivec2()) || !buffer.length) {
+    return;
+  }
+  _gl.enable_depth(true);
+  _gl.enable_blend(true);
+
+  bool instanced = _gl.has_instancing();
+  _sprite_program->bind();
+  if (instanced) {
+    _sprite_program->bind_attribute(corner_name, *_quad_vertex);
+    bind_sprite_attributes(*_sprite_program, *buffer.instance.buffer, 0, 1);
+  }
+  else {
+    _sprite_program->bind_attribute<2>(corner_name, *buffer.vertex.buffer, 0);
+    bind_sprite_attributes(*_sprite_program, *buffer.vertex.buffer, 2, 0);
+  }
+
+  _sprite_program->bind_uniform(sprite_name, sprite);
+  _sprite_program->bind_uniform(sprite_size_name, sprite.get_size());
+  _sprite_program->bind_uniform(normal_name, normal);
+  bind_pixel_uniforms(*_sprite_program);
+  if (instanced) {
+    _quad_element->draw_elements_instanced(
+        GL_TRIANGLE_STRIP, 4, buffer.length);
+  }
+  else {
+    quad_element(buffer.length).buffer->draw_elements(
+        GL_TRIANGLES, 6 * buffer.length);
+  }
+}
+
 y::ivec2 RenderUtil::from_grid(const y::ivec2& grid)
 {
   return grid * font_size;
@@ -463,9 +641,26 @@ y::ivec2 RenderUtil::to_grid(const y::ivec2& pixels)
 
 void RenderUtil::bind_pixel_uniforms(const GlProgram& program) const
 {
-  program.bind_uniform("resolution", _native_size);
-  program.bind_uniform("translation", _translation);
-  program.bind_uniform("scale", y::fvec2{_scale, _scale});
+  program.bind_uniform(resolution_name, _native_size);
+  program.bind_uniform(translation_name, _translation);
+  program.bind_uniform(scale_name, y::fvec2{_scale, _scale});
+}
+
+RenderUtil::batch_stats::batch_stats()
+  : sprites(0)
+  , batches(0)
+  , sort_ns(0)
+{
+}
+
+const RenderUtil::batch_stats& RenderUtil::get_batch_stats() const
+{
+  return _batch_stats;
+}
+
+void RenderUtil::reset_batch_stats() const
+{
+  _batch_stats = batch_stats();
 }
 
 const y::ivec2 RenderUtil::font_size{
@@ -6,6 +6,7 @@
 #include <map>
 
 class GlUtil;
+struct Sprite;
 
 template<typename T, typename U = std::vector<T>>
 void write_vector(std::vector<T>& dest, std::size_t dest_index, const U& source)
@@ -38,13 +39,26 @@ namespace colour {
   const y::fvec4 transparent{1.f, 1.f, 1.f, .5f};
 }
 
-// Helper class to automatically batch renders using the same texture.
+// Helper class to automatically batch renders using the same texture. Sprites
+// are collected in a flat list with a sort key for each, and grouped by sorting
+// the keys when the batch is rendered. Storage is kept when the batch is
+// cleared, so a batch that is reused every frame doesn't allocate.
 class RenderBatch {
 public:
 
+  // A sprite sheet: either a whole texture, or the region of a texture atlas
+  // where some image was packed.
+  struct sheet {
+    GlTexture2D texture;
+    y::ivec2 origin;
+    y::ivec2 size;
+  };
+  static sheet texture_sheet(const GlTexture2D& texture);
+  // Uses the atlas if the sprite was packed into one.
+  static sheet sprite_sheet(const Sprite& sprite, bool normal);
+
   struct batched_texture {
     GlTexture2D sprite;
-    y::ivec2 frame_size;
     bool normal;
   };
 
@@ -56,8 +70,22 @@ public:
     float depth;
     float rotation;
     y::fvec4 colour;
+    float frame_width;
+    float frame_height;
+    float sheet_left;
+    float sheet_top;
+    float sheet_width;
+    float sheet_height;
   };
+  static batched_sprite make_sprite(
+      const sheet& sheet, const y::ivec2& frame_size,
+      const y::fvec2& origin, const y::ivec2& frame,
+      float depth, float rotation, const y::fvec4& colour);
 
+  void add_sprite(
+      const sheet& sheet, const y::ivec2& frame_size, bool normal,
+      const y::fvec2& origin, const y::ivec2& frame,
+      float depth, float rotation, const y::fvec4& colour);
   void add_sprite(
       const GlTexture2D& sprite, const y::ivec2& frame_size, bool normal,
       const y::fvec2& origin, const y::ivec2& frame,
@@ -66,20 +94,62 @@ public:
                    const y::ivec2& origin, const y::ivec2& frame,
                    float depth, const y::fvec4& colour);
 
-  struct batched_texture_order {
-    bool operator()(const batched_texture& l, const batched_texture& r) const;
+  typedef std::vector<batched_sprite> batched_sprite_list;
+
+  // A run of sprites in the sorted list which use the same texture. Within a
+  // run, sprites are ordered back-to-front and otherwise in the order they
+  // were added.
+  struct texture_run {
+    batched_texture texture;
+    std::size_t first;
+    std::size_t count;
   };
+  typedef std::vector<texture_run> texture_run_list;
 
-  typedef std::vector<batched_sprite> batched_sprite_list;
-  typedef std::map<batched_texture, batched_sprite_list,
-                   batched_texture_order> batched_texture_map;
-  const batched_texture_map& get_map() const;
+  // Sort the sprites added since the last clear. The runs and sorted sprites
+  // are only valid after sorting.
+  void sort();
+  const texture_run_list& get_runs() const;
+  const batched_sprite_list& get_sorted_sprites() const;
   void clear();
 
 private:
 
-  batched_texture_map _map;
+  // Texture handle in the top 32 bits, then the normal flag, then the depth
+  // (inverted, so that further sprites come first).
+  static std::uint64_t make_key(const GlTexture2D& texture, bool normal,
+                                float depth);
 
+  struct sort_entry {
+    std::uint64_t key;
+    std::uint32_t index;
+  };
+  std::vector<sort_entry> _keys;
+  std::vector<sort_entry> _scratch;
+  std::vector<GlTexture2D> _textures;
+  batched_sprite_list _sprites;
+
+  batched_sprite_list _sorted;
+  texture_run_list _runs;
+
+};
+
+// Uploaded vertex data for a list of batched sprites. RenderUtil streams
+// everything it draws through one of these, but sprites which rarely change
+// (such as world tiles) can be written once to their own buffer and drawn
+// again every frame without touching the data.
+struct BatchBuffer {
+  BatchBuffer(GlUtil& gl, GLenum usage_hint);
+
+  // Per-sprite data is interleaved as origin (2), frame index (2), rotation,
+  // depth, colour (4), frame size (2) and sheet rectangle (4). When instancing
+  // is available there is one element per sprite; otherwise there is one per
+  // corner, each prefixed by the corner position (2).
+  static const std::size_t sprite_components = 16;
+  static const std::size_t vertex_components = 2 + sprite_components;
+  GlDatabuffer<float, sprite_components> instance;
+  GlDatabuffer<float, vertex_components> vertex;
+  std::size_t length;
 };
 
 class Window;
@@ -160,9 +230,19 @@ public:
 
   // Render an entire batch of sprites at once (at pixel coordinates).
   void render_batch(
-      const GlTexture2D& sprite, const y::ivec2& frame_size, bool normal,
-      const RenderBatch::batched_sprite_list& list) const;
-  void render_batch(const RenderBatch& batch) const;
+      const GlTexture2D& sprite, bool normal,
+      const RenderBatch::batched_sprite* sprites, std::size_t count) const;
+  void render_batch(RenderBatch& batch) const;
+
+  // Write and upload a list of sprites to a buffer, so that it can be rendered
+  // any number of times later on.
+  void write_batch(BatchBuffer& buffer,
+                   const RenderBatch::batched_sprite* sprites,
+                   std::size_t count) const;
+  void write_batch(BatchBuffer& buffer,
+                   const RenderBatch::batched_sprite_list& list) const;
+  void render_batch(const GlTexture2D& sprite, bool normal,
+                    const BatchBuffer& buffer) const;
 
   // Render a sprite immediately.
   void render_sprite(
@@ -180,6 +260,17 @@ public:
   // Helpers for standard uniform variables.
   void bind_pixel_uniforms(const GlProgram& program) const;
 
+  // Statistics for sprite batches rendered since the last reset.
+  struct batch_stats {
+    batch_stats();
+
+    std::size_t sprites;
+    std::size_t batches;
+    std::size_t sort_ns;
+  };
+  const batch_stats& get_batch_stats() const;
+  void reset_batch_stats() const;
+
 private:
 
   // Font width and height.
@@ -200,12 +291,8 @@ private:
   GlUnique<GlProgram> _draw_program;
   GlUnique<GlProgram> _sprite_program;
 
-  GlDatabuffer<float, 2> _pixels;
-  GlDatabuffer<float, 1> _rotation;
-  GlDatabuffer<float, 2> _origin;
-  GlDatabuffer<float, 2> _frame_index;
-  GlDatabuffer<float, 1> _depth;
-  GlDatabuffer<float, 4> _colour;
+  mutable BatchBuffer _batch;
+  mutable batch_stats _batch_stats;
   GlDatabuffer<GLushort, 1> _element;
 
 };
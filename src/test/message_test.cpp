@@ -0,0 +1,127 @@
+#include "../data/bank.h"
+#include "../filesystem/physical.h"
+#include "../game/stage.h"
+#include "../lua.h"
+#include "../render/gl_util.h"
+#include "../render/util.h"
+#include "../render/window.h"
+
+#include <iostream>
+
+// Checks that values sent with send_message() arrive intact after going
+// through the ScriptBank's message arena. Exits with status 1 if any check
+// fails.
+namespace {
+
+// The script sends messages to itself, and each check function reports
+// whether the corresponding message arrived as expected.
+const std::string test_source = R"lua(
+local received = {}
+local replies = 0
+
+function receive(name, ...)
+  received[name] = {...}
+end
+
+function send()
+  self:send_message("receive", "scalars", 1.5, true, "string")
+  self:send_message("receive", "vec", vec(100, 200))
+  self:send_message("receive", "nested", {vec(1, 2), {3, "four"}})
+
+  local t = {1, 0, vec(5, 6)}
+  t[2] = t
+  self:send_message("receive", "cycle", t)
+  self:send_message("ping")
+end
+
+function ping()
+  self:send_message("pong")
+end
+
+function pong()
+  replies = replies + 1
+end
+
+function check_scalars()
+  local r = received.scalars
+  return r ~= nil and r[1] == 1.5 and r[2] == true and r[3] == "string"
+end
+
+function check_vec()
+  local r = received.vec
+  return r ~= nil and r[1] == vec(100, 200)
+end
+
+function check_nested()
+  local r = received.nested
+  return r ~= nil and r[1][1] == vec(1, 2) and
+      r[1][2][1] == 3 and r[1][2][2] == "four"
+end
+
+function check_cycle()
+  local r = received.cycle
+  return r ~= nil and r[1][1] == 1 and r[1][2] == nil and
+      r[1][3] == vec(5, 6)
+end
+
+function check_reply_waits()
+  return replies == 0
+end
+
+function check_reply()
+  return replies == 1
+end
+)lua";
+
+bool check(Script& script, const std::string& name)
+{
+  Script::lua_args output;
+  script.call(output, "check_" + name);
+  bool passed = !output.empty() && output[0].boolean();
+  std::cout << (passed ? "pass " : "FAIL ") << name << std::endl;
+  return passed;
+}
+
+}
+
+std::int32_t main(std::int32_t argc, char**)
+{
+  // Usage: message_test
+  if (argc != 1) {
+    log_err("Usage: message_test");
+    return 1;
+  }
+
+  // The Databank and GameStage need a GL context, even though nothing is
+  // rendered.
+  Window window("Crunk Message Test", 24, RenderUtil::native_size,
+                false, true);
+  PhysicalFilesystem data_filesystem("data");
+  GlUtil gl(data_filesystem, window);
+  if (!gl) {
+    return 1;
+  }
+  Databank databank(data_filesystem, gl, false, &data_filesystem);
+  RenderUtil util(gl);
+  GlUnique<GlFramebuffer> framebuffer(gl.make_unique_framebuffer(
+      RenderUtil::native_size, false, true));
+  PhysicalFilesystem save_filesystem("save");
+  GameStage stage(databank, save_filesystem, util, *framebuffer,
+                  databank.maps.get_names()[0], y::wvec2(), true);
+
+  Script script(stage.get_lua(), "/test/message.lua", test_source,
+                y::wvec2(), y::wvec2{32., 32.});
+  script.call("send");
+  stage.get_scripts().handle_messages();
+
+  bool passed = true;
+  for (const char* name : {"scalars", "vec", "nested", "cycle"}) {
+    passed = check(script, name) && passed;
+  }
+
+  // Messages sent by a handler are only delivered by the next pass.
+  passed = check(script, "reply_waits") && passed;
+  stage.get_scripts().handle_messages();
+  passed = check(script, "reply") && passed;
+  return passed ? 0 : 1;
+}
@@ -9,6 +9,7 @@
 #include "render/util.h"
 #include "render/window.h"
 
+#include <fstream>
 #include <iomanip>
 #include <sstream>
 #include <SFML/Graphics.hpp>
@@ -77,12 +78,23 @@ GLfloat a_dither_compute(a_dither_pattern pattern, std::int32_t n)
 
 const bool use_a_dither = true;
 const a_dither_pattern a_dither = ADD_PATTERN_RGBSPLIT;
+// Upscaling filters. These need the post-processed image in a framebuffer of
+// its own, so they can only be used with the separate passes.
+const bool use_epx = false;
+const bool use_fra = false;
+// Whether to crop, dither and upscale in a single pass straight from the game
+// framebuffer, rather than through the intermediate crop and post buffers.
+// That saves two full-screen passes, which matters for fill-rate at high
+// window resolutions.
+const bool use_fused_present = true;
+// Number of scripts shown in the profile overlay, and where the CSV is dumped.
+const std::size_t profile_rows = 8;
+const std::string profile_csv_path = "tmp/profile.csv";
 GLfloat a_dither_matrix[a_dither_size(a_dither)];
 }
 
 Yugen::Yugen(RenderUtil& util, RunTiming& run_timing)
-  : _recording(false)
-  , _util(util)
+  : _util(util)
   , _run_timing(run_timing)
   , _framebuffer(util.get_gl().make_unique_framebuffer(
         RenderUtil::native_overflow_size, false, false))
@@ -100,10 +112,14 @@ Yugen::Yugen(RenderUtil& util, RunTiming& run_timing)
   , _upscale_program(util.get_gl().make_unique_program({
       "/shaders/upscale.v.glsl",
       "/shaders/upscale.f.glsl"}))
+  , _present_program(util.get_gl().make_unique_program({
+      "/shaders/present.v.glsl",
+      "/shaders/present.f.glsl"}))
   , _bayer_texture(util.get_gl().make_unique_texture<float, 3>(
       y::ivec3{8, 8, 1}, GL_R8, GL_RED, bayer_matrix, true))
   , _a_dither_texture()
   , _dither_frame(0)
+  , _capture(util.get_gl(), RenderUtil::native_size, "tmp/")
 {
   for (std::int32_t n = 0; n < a_dither_size(a_dither); ++n) {
     a_dither_matrix[n] = a_dither_compute(a_dither, n);
@@ -125,9 +141,6 @@ void Yugen::set_stage(GameStage* stage)
 
 Yugen::~Yugen()
 {
-  for (unsigned char* data : _save_file_frames) {
-    delete[] data;
-  }
 }
 
 void Yugen::event(const sf::Event& e)
@@ -139,6 +152,25 @@ void Yugen::event(const sf::Event& e)
   if (e.key.code == sf::Keyboard::Escape) {
     end();
   }
+  if (!_stage) {
+    return;
+  }
+
+  // Toggle the script profiler, or write out the current profile.
+  LuaProfiler& profiler = _stage->get_lua().get_profiler();
+  if (e.key.code == sf::Keyboard::F3) {
+    profiler.set_enabled(!profiler.is_enabled());
+  }
+  if (e.key.code == sf::Keyboard::F4) {
+    std::ofstream file(profile_csv_path);
+    profiler.write_csv(file);
+    if (file) {
+      log_info("Wrote script profile to ", profile_csv_path);
+    }
+    else {
+      log_err("Couldn't write script profile to ", profile_csv_path);
+    }
+  }
 }
 
 void Yugen::update()
@@ -148,9 +180,37 @@ void Yugen::update()
 void Yugen::draw() const
 {
   // Render the game.
+  _util.get_gl().reset_stream_stats();
+  _util.get_gl().reset_state_stats();
+  _util.reset_batch_stats();
   _util.set_resolution(_framebuffer->get_size());
   draw_next();
 
+  // Recording reads back the post buffer, so it has to start before the
+  // pipeline is chosen.
+  if (sf::Keyboard::isKeyPressed(sf::Keyboard::Tilde)) {
+    _capture.start();
+  }
+  const Resolution& screen = _util.get_window().get_mode();
+
+  if (use_fused_present && !use_epx && !use_fra &&
+      !_capture.is_recording()) {
+    // Crop, dither and upscale straight to the window, then draw the debug
+    // status on top at the same scale as the image.
+    _util.get_gl().bind_window(true, true);
+    present_render(*_framebuffer, screen.size);
+
+    const y::ivec2& native = RenderUtil::native_size;
+    std::int32_t scale = std::max(1, std::min(screen.size[xx] / native[xx],
+                                              screen.size[yy] / native[yy]));
+    y::ivec2 scaled = screen.size / scale;
+    _util.set_resolution(scaled);
+    _util.iadd_translation((scaled - native) / 2);
+    status_render();
+    _util.iadd_translation((native - scaled) / 2);
+    return;
+  }
+
   // Crop and rotate to the crop buffer.
   _crop_buffer->bind(true, true);
   crop_render(*_framebuffer, _crop_buffer->get_size());
@@ -160,10 +220,19 @@ void Yugen::draw() const
   post_render(*_crop_buffer, _post_buffer->get_size());
 
   // Render post buffer to a file.
-  recording_render(*_post_buffer);
+  recording_render();
 
   // Render debug status.
   _util.set_resolution(_post_buffer->get_size());
+  status_render();
+
+  // Upscale the post-buffer to the window.
+  _util.get_gl().bind_window(true, true);
+  upscale_render(*_post_buffer, screen.size);
+}
+
+void Yugen::status_render() const
+{
   float fps_avg = 1000000.f / _run_timing.us_per_frame_avg;
   float fps_inst = 1000000.f / _run_timing.us_per_frame_inst;
   float update_pct = 100.f *
@@ -198,15 +267,79 @@ void Yugen::draw() const
       update_pct << "% update; " <<
       std::setw(1) <<
       _run_timing.updates_this_cycle << " updates";
-  if (_recording) {
-    ss << " [recording]";
+  if (_capture.is_recording()) {
+    ss << " [recording " << _capture.get_frames_written() << " / " <<
+        _capture.get_frames_captured() << ", " <<
+        _capture.get_frames_dropped() << " dropped]";
   }
   _util.irender_text(ss.str(), {16, 32}, colour::white);
 
-  // Upscale the post-buffer to the window.
-  const Resolution& screen = _util.get_window().get_mode();
-  _util.get_gl().bind_window(true, true);
-  upscale_render(*_post_buffer, screen.size);
+  const GlStreamState& stream = _util.get_gl().get_stream_stats();
+  ss.str(std::string());
+  ss.clear();
+  ss << std::setw(5) << stream.bytes / 1024 << " KiB / " <<
+      std::setw(5) << stream.ns / 1000 << " us upload (" <<
+      stream.uploads << " buffers, " << stream.orphans << " orphaned)";
+  _util.irender_text(ss.str(), {16, 40}, colour::white);
+
+  const RenderUtil::batch_stats& batches = _util.get_batch_stats();
+  ss.str(std::string());
+  ss.clear();
+  ss << std::setw(5) << batches.sprites << " sprites in " <<
+      std::setw(4) << batches.batches << " batches (" <<
+      batches.sort_ns / 1000 << " us sorting)";
+  _util.irender_text(ss.str(), {16, 48}, colour::white);
+
+  const GlStateCache& state = _util.get_gl().get_state_stats();
+  ss.str(std::string());
+  ss.clear();
+  ss << std::setw(5) << state.issued << " GL state changes / " <<
+      std::setw(5) << state.skipped << " skipped";
+  _util.irender_text(ss.str(), {16, 56}, colour::white);
+
+  if (_stage) {
+    const LuaVm& lua = _stage->get_lua();
+    const LuaVm::gc_stats& gc = lua.get_gc_stats();
+    ss.str(std::string());
+    ss.clear();
+    ss << std::setw(5) << gc.ns / 1000 << " / " <<
+        std::setw(5) << gc.budget_us << " us GC (" <<
+        gc.steps << " steps, " << gc.cycles << " cycles, " <<
+        lua.get_memory() / 1024 << " KiB heap)";
+    _util.irender_text(ss.str(), {16, 64}, colour::white);
+  }
+
+  if (_stage && _stage->get_lua().get_profiler().is_enabled()) {
+    profile_render({16, 80});
+  }
+}
+
+void Yugen::profile_render(const y::ivec2& origin) const
+{
+  const LuaVm& lua = _stage->get_lua();
+  const LuaProfiler& profiler = lua.get_profiler();
+  std::size_t frames = std::max(std::size_t(1), profiler.get_frames());
+  LuaProfiler::row_list rows;
+  profiler.get_rows(rows);
+
+  std::stringstream ss;
+  ss << "Script profile: " << profiler.get_frames() << " frames; " <<
+      lua.get_memory() / 1024 << " KiB heap; per frame:";
+  _util.irender_text(ss.str(), origin, colour::white);
+
+  for (std::size_t i = 0; i < rows.size() && i < profile_rows; ++i) {
+    const LuaProfiler::entry& e = *rows[i].stats;
+    ss.str(std::string());
+    ss.clear();
+    ss << std::setw(5) << e.ns_total / (1000 * frames) << " us (" <<
+        std::setw(5) << e.ns_api / (1000 * frames) << " api) " <<
+        std::setw(4) << e.calls / frames << " calls " <<
+        std::setw(6) << e.heap_bytes / std::int64_t(frames) << " B " <<
+        *rows[i].path << ":" << *rows[i].function;
+    _util.irender_text(
+        ss.str(), origin + y::ivec2{0, std::int32_t(8 * (1 + i))},
+        colour::white);
+  }
 }
 
 void Yugen::crop_render(const GlFramebuffer& source,
@@ -225,23 +358,11 @@ void Yugen::crop_render(const GlFramebuffer& source,
 void Yugen::post_render(const GlFramebuffer& source,
                         const y::ivec2& target_size) const
 {
-  const GlUnique<GlTexture3D>& dither = use_a_dither ?
-      _a_dither_texture : _bayer_texture;
-
   _post_program->bind();
   _post_program->bind_attribute("position", _util.quad_vertex());
   _post_program->bind_uniform("native_res", target_size);
   _post_program->bind_uniform("framebuffer", source);
-  _post_program->bind_uniform("dither_matrix", *dither);
-  _post_program->bind_uniform("dither_res", y::ivec2{
-      dither->get_size()[xx], dither->get_size()[yy]});
-  _post_program->bind_uniform(
-      "dither_off", _stage ?
-          y::fvec2(_stage->get_camera().camera_to_world(y::wvec2())) :
-          y::fvec2());
-  _post_program->bind_uniform(
-      "dither_rot", _stage ? float(_stage->get_camera().get_rotation()) : 0.f);
-  _post_program->bind_uniform("dither_frame", std::int32_t(++_dither_frame));
+  dither_uniforms(*_post_program);
   _util.quad_element().draw_elements(GL_TRIANGLE_STRIP, 4);
 }
 
@@ -253,48 +374,54 @@ void Yugen::upscale_render(const GlFramebuffer& source,
   _upscale_program->bind_uniform("screen_res", target_size);
   _upscale_program->bind_uniform("native_res", source.get_size());
   _upscale_program->bind_uniform("integral_scale_lock", true);
-  _upscale_program->bind_uniform("use_epx", false);
-  _upscale_program->bind_uniform("use_fra", false);
+  _upscale_program->bind_uniform("use_epx", use_epx);
+  _upscale_program->bind_uniform("use_fra", use_fra);
   _upscale_program->bind_uniform("framebuffer", source);
   _util.quad_element().draw_elements(GL_TRIANGLE_STRIP, 4);
 }
 
-void Yugen::recording_render(const GlFramebuffer& source) const
+void Yugen::present_render(const GlFramebuffer& source,
+                           const y::ivec2& target_size) const
+{
+  _present_program->bind();
+  _present_program->bind_attribute("position", _util.quad_vertex());
+  _present_program->bind_uniform("screen_res", target_size);
+  _present_program->bind_uniform("native_res", RenderUtil::native_size);
+  _present_program->bind_uniform("native_overflow_res", source.get_size());
+  _present_program->bind_uniform("integral_scale_lock", true);
+  _present_program->bind_uniform(
+      "rotation", _stage ? float(_stage->get_camera().get_rotation()) : 0.f);
+  _present_program->bind_uniform("framebuffer", source);
+  dither_uniforms(*_present_program);
+  _util.quad_element().draw_elements(GL_TRIANGLE_STRIP, 4);
+}
+
+void Yugen::dither_uniforms(const GlProgram& program) const
+{
+  const GlUnique<GlTexture3D>& dither = use_a_dither ?
+      _a_dither_texture : _bayer_texture;
+
+  program.bind_uniform("dither_matrix", *dither);
+  program.bind_uniform("dither_res", y::ivec2{
+      dither->get_size()[xx], dither->get_size()[yy]});
+  program.bind_uniform(
+      "dither_off", _stage ?
+          y::fvec2(_stage->get_camera().camera_to_world(y::wvec2())) :
+          y::fvec2());
+  program.bind_uniform(
+      "dither_rot", _stage ? float(_stage->get_camera().get_rotation()) : 0.f);
+  program.bind_uniform("dither_frame", std::int32_t(++_dither_frame));
+}
+
+void Yugen::recording_render() const
 {
-  if (sf::Keyboard::isKeyPressed(sf::Keyboard::Tilde)) {
-    _recording = true;
-  }
-  if (_recording) {
-    y::ivec2 size = source.get_size();
-    std::int32_t length = 4 * size[xx] * size[yy];
-    unsigned char* data = new unsigned char[length];
-    glReadPixels(0, 0, size[xx], size[yy], GL_RGBA, GL_UNSIGNED_BYTE, data);
-    _save_file_frames.emplace_back(data);
-  }
   if (sf::Keyboard::isKeyPressed(sf::Keyboard::BackSpace)) {
-    _recording = false;
-    _save_file_frames.clear();
+    _capture.stop(true);
   }
   if (sf::Keyboard::isKeyPressed(sf::Keyboard::Return)) {
-    _recording = false;
-    std::size_t n = 0;
-    for (unsigned char* data : _save_file_frames) {
-      y::ivec2 size = source.get_size();
-      sf::Image image;
-      image.create(size[xx], size[yy], data);
-      image.flipVertically();
-
-      std::stringstream ss;
-      ss << "tmp/" << std::setw(4) << std::setfill('0') << n++ << ".png";
-      image.saveToFile(ss.str());
-      delete[] data;
-      std::cout << "Saved frame " <<
-          n << " of " << _save_file_frames.size() << std::endl;
-    }
-    _save_file_frames.clear();
+    _capture.stop(false);
   }
-  _run_timing.target_updates_per_second =
-      _run_timing.target_draws_per_second = _recording ? 0.f : 60.f;
+  _capture.capture();
 }
 
 std::int32_t main(std::int32_t argc, char** argv)
@@ -316,7 +443,7 @@ std::int32_t main(std::int32_t argc, char** argv)
   if (!gl) {
     return 1;
   }
-  Databank databank(data_filesystem, gl);
+  Databank databank(data_filesystem, gl, false, &data_filesystem);
   RenderUtil util(gl);
 
   std::string map = databank.maps.get_names()[0];
@@ -343,6 +470,7 @@ std::int32_t main(std::int32_t argc, char** argv)
   GameStage* stage = new GameStage(
       databank, save_filesystem,
       util, yugen->get_framebuffer(), map, world);
+  stage->set_run_timing(run_timing);
   yugen->set_stage(stage);
 
   ModalStack stack;
@@ -2,6 +2,7 @@
 #define YUGEN_H
 
 #include "modal.h"
+#include "render/capture.h"
 #include "render/gl_handle.h"
 
 #include <SFML/System.hpp>
@@ -35,10 +36,12 @@ private:
                    const y::ivec2& target_size) const;
   void upscale_render(const GlFramebuffer& source,
                       const y::ivec2& target_size) const;
-  void recording_render(const GlFramebuffer& source) const;
-
-  mutable bool _recording;
-  mutable std::vector<unsigned char*> _save_file_frames;
+  void present_render(const GlFramebuffer& source,
+                      const y::ivec2& target_size) const;
+  void dither_uniforms(const GlProgram& program) const;
+  void status_render() const;
+  void profile_render(const y::ivec2& origin) const;
+  void recording_render() const;
 
   RenderUtil& _util;
   RunTiming& _run_timing;
@@ -51,9 +54,11 @@ private:
   GlUnique<GlProgram> _crop_program;
   GlUnique<GlProgram> _post_program;
   GlUnique<GlProgram> _upscale_program;
+  GlUnique<GlProgram> _present_program;
   GlUnique<GlTexture3D> _bayer_texture;
   GlUnique<GlTexture3D> _a_dither_texture;
   mutable std::size_t _dither_frame;
+  mutable FrameCapture _capture;
 
 };
 